@@ -9,13 +9,14 @@ def random_int(low, high):
     return random.randint(low, high)
 
 def main():
-    if len(sys.argv) != 2:
-        print(f"Usage: {sys.argv[0]} <number_of_spheres>")
+    if len(sys.argv) not in (2, 3):
+        print(f"Usage: {sys.argv[0]} <number_of_spheres> [seed]")
         sys.exit(1)
     
     n = int(sys.argv[1])
-    # Seed for reproducibility (optional)
-    # random.seed(42)
+    # Seed for reproducibility, make bench always passes one
+    if len(sys.argv) == 3:
+        random.seed(int(sys.argv[2]))
     
     # print("# Randomly generated spheres")
     for _ in range(n):
@@ -6,7 +6,7 @@
 /*   By: sabruma <sabruma@student.42.fr>            +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2026/03/31 15:17:19 by gmu               #+#    #+#             */
-/*   Updated: 2026/03/31 23:33:41 by gmu              ###   ########.fr       */
+/*   Updated: 2026/10/17 22:58:43 by gmu              ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -25,7 +25,9 @@
 # include "math_engine.h"
 # include "minirt_data.h"
 # include "parsing_minirt.h"
-# include "mlx_minirt.h"
+# ifndef MINIRT_HEADLESS
+#  include "mlx_minirt.h"
+# endif
 # include "minirt_renderer.h"
 
 #endif
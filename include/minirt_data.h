@@ -6,7 +6,7 @@
 /*   By: sabruma <sabruma@student.42firenze.it>     +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2026/03/23 00:01:14 by sabruma           #+#    #+#             */
-/*   Updated: 2026/03/23 00:01:15 by sabruma          ###   ########.fr       */
+/*   Updated: 2026/10/17 23:30:40 by gmu              ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -57,11 +57,25 @@ typedef struct s_cylinder
 	t_rgb		color;
 }	t_cylinder;
 
+// which member of the union a t_element holds, ELEM_END closes the array.
+// the order is the one of the dispatch tables (parser and init_math)
+typedef enum e_elem_type
+{
+	ELEM_END,
+	ELEM_AMBIENT,
+	ELEM_CAMERA,
+	ELEM_LIGHT,
+	ELEM_SPHERE,
+	ELEM_PLANE,
+	ELEM_CYLINDER,
+	ELEM_TYPES
+}	t_elem_type;
+
 // Data record of the .rt file
 // vec3 in t_element is a normalized 3D vector, range [-1,1] foreach direction
 typedef struct s_element
 {
-	char	*id;
+	t_elem_type	type;
 	union u_entity
 	{
 		t_ambient	a;
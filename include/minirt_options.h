@@ -0,0 +1,74 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   minirt_options.h                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: gmu <marvin@42.fr>                         +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 22:21:55 by gmu               #+#    #+#             */
+/*   Updated: 2026/10/18 00:28:25 by gmu              ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef MINIRT_OPTIONS_H
+# define MINIRT_OPTIONS_H 1
+
+# include <stdbool.h>
+# include "dispatch/isa.h"
+
+# define TILE_SIZE 32
+# define MAX_THREADS 256
+
+// frame size when --size isn't given
+# define IMG_WIDTH 1368
+# define IMG_HEIGHT 786
+
+// #define IMG_WIDTH 400
+// #define IMG_HEIGHT 300
+
+// largest side --size accepts
+# define MAX_IMG_SIDE 65536
+
+// file formats of --output, picked from the extension
+typedef enum e_image_format
+{
+	IMG_NONE,
+	IMG_PPM,
+	IMG_PFM
+}	t_image_format;
+
+// command line switches, everything but the scene path is optional:
+// ./miniRT [--threads N] [--tile N] [--size WxH]
+//          [--output out.ppm|out.pfm [--strip N]]
+//          [--bench N [--json out.json]] [--export-binary out.rtb]
+//          [--stats] [--stats-json out.json] [--isa LEVEL]
+//          <scene.rt|scene.rtb>
+// with an output file the frame is written there and no window is opened,
+// N rows at a time so any --size fits in memory.
+// --bench renders the frame N times without a window and reports timings.
+// --export-binary saves the loaded scene as .rtb, alone it renders nothing.
+// --stats prints where the time went once the frame is done.
+// --isa forces the kernel level (auto, sse2, avx2, avx512), default auto
+typedef struct s_options
+{
+	char			*scene;
+	char			*output;
+	char			*json;
+	char			*export_binary;
+	char			*stats_json;
+	t_image_format	format;
+	int				bench_runs;	// timed frames, 0 when not benchmarking
+	int				threads;	// render workers, defaults to the online cpus
+	int				tile_size;	// side of the square tiles handed to workers
+	int				width;
+	int				height;
+	int				strip_rows;	// rows per --output strip, 0 picks them
+	t_isa			isa;
+	bool			stats;
+}	t_options;
+
+bool	parse_options(int argc, char **argv, t_options *opts);
+bool	parse_count(const char *s, int *out);
+int		parse_number(char **argv, int i, t_options *opts);
+
+#endif
@@ -0,0 +1,85 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   minirt_output.h                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: sabruma <sabruma@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 22:57:34 by sabruma           #+#    #+#             */
+/*   Updated: 2026/10/18 00:03:42 by sabruma          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef MINIRT_OUTPUT_H
+# define MINIRT_OUTPUT_H 1
+
+# include <stdint.h>
+# include "math_engine.h"
+# include "minirt_data.h"
+# include "minirt_options.h"
+# include "minirt_stats.h"
+
+// what the renderer draws into, a window image or a plain buffer.
+// pixels are 0x00RRGGBB like mlx images, stride is a row in pixels.
+// hdr, when set, also gets the unclamped color of each pixel (for PFM).
+// a strip holds image rows [y0, y0 + height), a whole frame has y0 == 0
+typedef struct s_framebuffer
+{
+	uint32_t	*pixels;
+	t_vec3		*hdr;
+	int			width;
+	int			height;
+	int			stride;
+	int			y0;
+}	t_framebuffer;
+
+// the --output file while strips are written into it with pwrite:
+// header bytes, then height rows of row_size bytes each. buf converts
+// one strip to the file format
+typedef struct s_image_file
+{
+	const t_options	*opts;
+	const char		*path;
+	void			*buf;
+	size_t			header;
+	size_t			row_size;
+	int				height;
+	int				fd;
+	bool			pfm;
+}	t_image_file;
+
+// without a row budget from --strip, a strip gets about this many pixels
+# define STRIP_PIXELS 2097152
+
+int		fb_init(t_framebuffer *fb, int width, int height, bool hdr);
+void	fb_destroy(t_framebuffer *fb);
+int		fb_write(const t_framebuffer *fb, const t_options *opts);
+int		image_open(t_image_file *img, const t_options *opts, int strip_rows);
+int		image_write_strip(t_image_file *img, const t_framebuffer *fb);
+int		image_close(t_image_file *img, int err);
+
+// timings of a --bench run, frame_ms is sorted once all frames are done.
+// rays is per frame: primary rays plus one shadow ray for every hit
+typedef struct s_bench
+{
+	const char	*scene;
+	double		setup_ms;
+	double		*frame_ms;
+	int			runs;
+	int			threads;
+	int			width;
+	int			height;
+	long		rays;
+	t_stats		*stats;
+}	t_bench;
+
+// where a frame ends up: a window, or a file without any display.
+// the caller keeps the t_math (the window frees it when it closes).
+// stats already holds the load and build stages and collects the rest
+void	mlx_init_windows_minirt(t_math *math, t_options *opts, t_stats *stats);
+int		render_to_file(t_math *math, t_options *opts, t_stats *stats);
+int		render_bench(t_math *math, t_options *opts, t_stats *stats);
+int		bench_report(const t_bench *b, const t_options *opts);
+double	now_ms(void);
+
+#endif
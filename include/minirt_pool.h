@@ -0,0 +1,73 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   minirt_pool.h                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: sabruma <sabruma@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 22:21:55 by sabruma           #+#    #+#             */
+/*   Updated: 2026/10/18 01:21:08 by sabruma          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef MINIRT_POOL_H
+# define MINIRT_POOL_H 1
+
+# include <pthread.h>
+# include <stdbool.h>
+
+// half-open pixel rectangle [x0, x1) x [y0, y1)
+typedef struct s_tile
+{
+	int	x0;
+	int	y0;
+	int	x1;
+	int	y1;
+}	t_tile;
+
+// ctx is shared by every worker, worker is the id of the caller
+typedef void	(*t_tile_fn)(void *ctx, const t_tile *tile, int worker);
+
+typedef struct s_job
+{
+	t_tile		*tiles;
+	int			count;
+	t_tile_fn	run;
+	void		*ctx;
+}	t_job;
+
+// tile indices owned by one worker: the owner pops from the tail,
+// thieves steal from the head, both under the same lock
+typedef struct s_deque
+{
+	pthread_mutex_t	lock;
+	int				*items;
+	int				head;
+	int				tail;
+}	t_deque;
+
+typedef struct s_worker
+{
+	struct s_pool	*pool;
+	pthread_t		thread;
+	t_deque			deque;
+	int				id;
+	bool			started;
+}	t_worker;
+
+typedef struct s_pool
+{
+	t_worker	*workers;
+	int			*slots;
+	int			count;
+	t_job		*job;
+}	t_pool;
+
+t_tile	*tiles_split(t_tile area, int size, int *count);
+void	pool_run(t_job *job, int threads);
+
+int		deque_fill(t_deque *dq, int first, int step, int end);
+bool	deque_pop(t_deque *dq, int *item);
+bool	deque_steal(t_deque *dq, int *item);
+
+#endif
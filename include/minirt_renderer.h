@@ -6,7 +6,7 @@
 /*   By: sabruma <sabruma@student.42.fr>            +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2026/03/22 23:59:08 by sabruma           #+#    #+#             */
-/*   Updated: 2026/03/31 23:39:56 by gmu              ###   ########.fr       */
+/*   Updated: 2026/10/18 01:22:00 by sabruma          ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -14,14 +14,9 @@
 # define MINIRT_RENDERER_H
 
 # include "minirt_data.h"
-# include "mlx_minirt.h"
+# include "minirt_output.h"
 # include "math_engine.h"
-
-# define IMG_WIDTH 1368
-# define IMG_HEIGHT 786
-
-// #define IMG_WIDTH 400
-// #define IMG_HEIGHT 300
+# include "minirt_pool.h"
 
 typedef struct s_material
 {
@@ -29,17 +24,86 @@ typedef struct s_material
 	float	shininess;
 }	t_material;
 
-void	render_minirt(t_mlx_minirt *mlx, t_math *math);
+# define CACHE_LINE 64
+
+// one worker's ray count, alone on its cache line so workers finishing
+// tiles at the same time don't write to the same line
+typedef struct s_ray_count
+{
+	long	n;
+}	__attribute__((aligned(CACHE_LINE)))	t_ray_count;
+
+// shared by the render workers, each writes its own tiles of fb
+// and counts the rays it casts in rays[worker]
+typedef struct s_render
+{
+	t_framebuffer	*fb;
+	t_math			*math;
+	t_ray_count		rays[MAX_THREADS];
+	t_stats			*stats;
+}	t_render;
+
+// init_math dispatch: builds the math of one element, next[type] is the
+// next free slot of each array. 0 on success like the create_ functions
+typedef int	(*t_elem_init)(t_math *m, t_element *e, int *next);
+
+// state of one closest-hit query: ray.t_max shrinks to best_t as closer
+// primitives are found, entry[i] is where the ray enters stack[i]
+typedef struct s_trace
+{
+	t_ray			ray;
+	t_vec3			inv_dir;
+	const t_math	*math;
+	t_bvh_ref		best;
+	float			best_t;
+	int				stack[BVH_STACK];
+	float			entry[BVH_STACK];
+	int				top;
+}	t_trace;
+
+// t_trace for a 4x2 packet: per-lane state lives in p, mask[i] holds the
+// lanes that entered stack[i] and entry[i] the nearest of their entries
+typedef struct s_packet_trace
+{
+	t_ray_packet	p;
+	const t_math	*math;
+	t_bvh_ref		best[PACKET_SIZE];
+	int				stack[BVH_STACK];
+	float			entry[BVH_STACK];
+	int				mask[BVH_STACK];
+	int				top;
+	int				lanes;	// active lanes, what each packet test counts
+}	t_packet_trace;
+
+long	render_minirt(t_framebuffer *fb, t_math *math, const t_options *opts,
+			t_stats *stats);
 t_rgb	ray_cast(const t_ray ray, t_math *math);
+t_vec3	ray_shade(const t_ray ray, t_math *math, const t_hit *hit);
 bool	trace(const t_ray ray, const t_math *math, t_hit *near, int *idx);
+void	hit_finalize(const t_math *math, const t_ray *ray, t_bvh_ref best,
+			t_hit *near);
+void	loop_bvh(t_trace *tr);
+void	trace_packet(const t_ray *rays, int active, const t_math *math,
+			t_hit *hits);
+void	loop_packet_bvh(t_packet_trace *pt);
+void	packet_record(t_packet_trace *pt, int lanes, t_bvh_ref ref);
+void	packet_cylinder(t_packet_trace *pt, const t_bvh_ref *ref, int lanes);
+void	packet_planes(t_packet_trace *pt);
+bool	trace_occluded(const t_ray ray, const t_math *math);
 t_vec3	lighting(t_material material, t_math *math, t_hit hit);
 
 t_math	*init_math(t_element *d);
 
-// Internal init utils because of norminette
-t_math	*init_spheres(t_math *m, t_element *d, int *i);
-t_math	*init_planes(t_math *m, t_element *d, int *i);
-t_math	*init_cylinders(t_math *m, t_element *d, int *i);
+int		init_ambient(t_math *m, t_element *e, int *next);
+int		init_camera(t_math *m, t_element *e, int *next);
+int		init_light(t_math *m, t_element *e, int *next);
+int		init_sphere(t_math *m, t_element *e, int *next);
+int		init_plane(t_math *m, t_element *e, int *next);
+int		init_cylinder(t_math *m, t_element *e, int *next);
+t_math	*init_bvh(t_math *m);
+void	bvh_order(t_math *m, const t_sphere_math *sp,
+			const t_cylinder_math *cy);
+void	leaf_spheres(const t_math *m, const t_bvh_node *node, int range[2]);
 
 void	destroy_math(t_math *math_engine);
 
@@ -0,0 +1,83 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   minirt_scene.h                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: sabruma <sabruma@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:20:59 by sabruma           #+#    #+#             */
+/*   Updated: 2026/10/18 00:37:48 by sabruma          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef MINIRT_SCENE_H
+# define MINIRT_SCENE_H 1
+
+# include <stddef.h>
+# include <stdint.h>
+# include "math_engine.h"
+# include "minirt_options.h"
+# include "minirt_stats.h"
+
+// .rtb: the t_math of a scene as init_math leaves it (primitives in BVH
+// order, the BVH itself and the sphere SoA), so loading is one mmap.
+// the file only makes sense on the build that wrote it: byte order,
+// version and the size of every record are checked before use
+//
+// layout: t_rtb_header, then each section at an RTB_ALIGN offset, the
+// gaps are zeros. the checksum covers the header (with checksum = 0)
+// and every section, not the gaps
+# define RTB_MAGIC "miniRTb"
+# define RTB_VERSION 2
+# define RTB_BYTE_ORDER 0x01020304u
+# define RTB_ALIGN 64
+
+typedef enum e_rtb_section
+{
+	RTB_SPHERES,
+	RTB_PLANES,
+	RTB_CYLINDERS,
+	RTB_BVH_NODES,
+	RTB_BVH_REFS,
+	RTB_SOA,
+	RTB_SOA_COLORS,
+	RTB_SECTIONS
+}	t_rtb_section;
+
+// where a section starts in the file, how many records and how big
+typedef struct s_rtb_span
+{
+	uint64_t	offset;
+	uint64_t	count;
+	uint64_t	item_size;
+}	t_rtb_span;
+
+// soa_stride is the distance between the x, y, z and r2 arrays of the
+// SoA, the RTB_SOA section holds all four back to back
+typedef struct s_rtb_header
+{
+	char			magic[8];
+	uint32_t		byte_order;
+	uint32_t		version;
+	uint64_t		header_size;
+	uint64_t		file_size;
+	uint64_t		checksum;
+	uint64_t		soa_stride;
+	t_rtb_span		spans[RTB_SECTIONS];
+	t_ambient_math	ambient;
+	t_camera_math	camera;
+	t_light_math	light;
+}	t_rtb_header;
+
+// scene_load: .rtb files are mapped, anything else is parsed as .rt
+// (on opts->threads threads when it is big), then the camera is set to
+// the --size frame. the load and build stages go to stats,
+// prints its own errors
+t_math		*load_scene(const t_options *opts, t_stats *stats);
+
+int			rtb_export(const t_math *m, const char *path);
+t_math		*rtb_load(const char *path);
+const char	*rtb_verify(const t_rtb_header *h, size_t size);
+uint64_t	rtb_checksum(const t_rtb_header *h, const void **sections);
+
+#endif
@@ -0,0 +1,86 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   minirt_stats.h                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: sabruma <sabruma@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:59:32 by sabruma           #+#    #+#             */
+/*   Updated: 2026/10/17 23:59:32 by sabruma          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef MINIRT_STATS_H
+# define MINIRT_STATS_H 1
+
+# include "minirt_options.h"
+
+// what the hot loops count. tests are ray-primitive tests, a packet
+// test counts once per lane of the packet
+typedef enum e_counter
+{
+	STAT_PRIMARY,
+	STAT_SHADOW,
+	STAT_HITS,
+	STAT_OCCLUDED,
+	STAT_AABB,
+	STAT_SPHERE,
+	STAT_PLANE,
+	STAT_CYLINDER,
+	COUNTERS
+}	t_counter;
+
+// load is parsing (or mapping a .rtb), build is init_math with the BVH,
+// write is the pixel conversion and the file output
+typedef enum e_stage
+{
+	STAGE_LOAD,
+	STAGE_BUILD,
+	STAGE_RENDER,
+	STAGE_WRITE,
+	STAGES
+}	t_stage;
+
+// cpu time is the whole process, over wall time it says how many
+// threads were busy. since_* hold the start of a running stage
+typedef struct s_stats
+{
+	long	count[COUNTERS];
+	double	wall_ms[STAGES];
+	double	cpu_ms[STAGES];
+	double	since_wall[STAGES];
+	double	since_cpu[STAGES];
+}	t_stats;
+
+void	stage_begin(t_stats *s, t_stage stage);
+void	stage_end(t_stats *s, t_stage stage);
+int		stats_report(const t_stats *s, const t_options *opts);
+
+// make STATS=1 counts into a per thread block, stats_flush adds it to
+// the frame totals once per tile. release builds have no counters at all:
+// the calls are empty and vanish from trace and ray_cast
+# ifdef MINIRT_STATS
+
+#  define STATS_COUNTERS 1
+
+void	stat_add(t_counter counter, long n);
+void	stats_flush(t_stats *dst);
+
+# else
+
+#  define STATS_COUNTERS 0
+
+static inline void	stat_add(t_counter counter, long n)
+{
+	(void)counter;
+	(void)n;
+}
+
+static inline void	stats_flush(t_stats *dst)
+{
+	(void)dst;
+}
+
+# endif
+
+#endif
@@ -6,7 +6,7 @@
 /*   By: sabruma <sabruma@student.42firenze.it>     +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2026/03/23 00:01:04 by sabruma           #+#    #+#             */
-/*   Updated: 2026/03/23 00:14:58 by sabruma          ###   ########.fr       */
+/*   Updated: 2026/10/17 23:24:09 by gmu              ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -15,6 +15,8 @@
 
 # include "mlx.h"
 # include "math_engine.h"
+# include "minirt_options.h"
+# include "minirt_output.h"
 
 typedef struct s_mlx_minirt
 {
@@ -25,11 +27,10 @@ typedef struct s_mlx_minirt
 	int			bpp;
 	int			line_len;
 	int			endian;
-	t_element	*data_file;
 	t_math		*math;
+	t_options	*opts;
 }	t_mlx_minirt;
 
-void	mlx_init_windows_minirt(t_element *data_file);
 void	print_t_element(t_element *elem);
 void	print_t_element_array_sentinel(t_element *arr);
 void	print_camera_data(const t_camera_data *cam);
@@ -6,74 +6,95 @@
 /*   By: gmu <marvin@42.fr>                         +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2026/03/31 15:16:05 by gmu               #+#    #+#             */
-/*   Updated: 2026/03/31 15:16:12 by gmu              ###   ########.fr       */
+/*   Updated: 2026/10/18 01:00:42 by gmu              ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #ifndef PARSING_MINIRT_H
 # define PARSING_MINIRT_H 1
 
-double		ft_strtod(const char *str, char **endptr);
-double		ft_atod(const char *str);
-// utility per parsing
-bool		check_n_comma(char *s, int n_comma);
-int			ft_word_count(char *str);
-bool		check_rgb_format(char *str);
-bool		convertable_double(double *value, const char *str);
-double		convert_double_strtod(char *str);
-bool		check_coordinates(char *s);
-bool		check_normalizzation_limits(char *str);
+# include <pthread.h>
+# include <stdbool.h>
+# include <stddef.h>
+# include "minirt_data.h"
+# include "memory.h"
 
-// funzioni chiamate
-bool		check_ambient(char *str);
-bool		check_camera(char *str);
-bool		check_light(char *str);
-bool		check_sphere(char *str);
-bool		check_plane(char *str);
-bool		check_cylinder(char *str);
+// A, C e L si possono dichiarare una volta sola
+# define SEEN_A 1
+# define SEEN_C 2
+# define SEEN_L 4
 
-void		print_debug_matrix(char **matrix);
-int			matrix_size(char **matrix);
-double		convert_double_strtod(char *str);
-bool		convertable_double(double *value, const char *str);
+// sotto questa dimensione per thread il parsing resta seriale
+# define PARSE_CHUNK_MIN 1048576
 
-int			check_split(char *s1);
-int			matrix_strlen_check(char **matrix);
-char		*read_from_file(int fd);
-char		**matrix_compress(char **matrix);
-bool		matrix_compress_app(char **matrix, char **new_matrix);
-char		*compress_space(char *str);
-int			count_non_empty_lines(char **matrix);
-int			is_empty_lines(char *str);
-// funzione che chiama le funzioni sopra e controlla riga per riga
-// questa e' quella da modificare nel caso volessi aggiungere altre forme
-// geometriche, per farlo aggiungi una funzione nella cascata degli if else
-// le funzioni che stanno sopra controllano il formato riga per riga
-// se realmente non e' chiaro ancora cosa fanno usa il printf
-// per stampare le stringhe e usa print_debug_matrix
-// per stampare le matrici,
-// la funzione e' qua sotto per vedere cosa contiene
-// DOPO aver letto il contenuto delle
-// stringhe o matrici e' impossibile non capire
-bool		check_matrix_data_is_good(char **matrix);
+// posizione del parser dentro il testo della scena, line parte da 1.
+// seen tiene le lettere maiuscole gia' trovate, quiet zittisce gli errori
+typedef struct s_cursor
+{
+	const char	*p;
+	int			line;
+	int			seen;
+	bool		quiet;
+}	t_cursor;
+
+// un tipo di riga: l'identificatore all'inizio e chi legge il resto
+typedef struct s_elem_syntax
+{
+	const char	*id;
+	bool		(*parse)(t_cursor *c, t_element *e);
+}	t_elem_syntax;
 
-// funzione chiamata nel main che controlla il numero di '\n' minimo
-// e la lunghezza minima della stringa
-t_element	*parse_input(int argc, char **argv);
+// un pezzo di file [start, end) che finisce dopo un '\n', con i suoi
+// elementi: i pezzi vengono riuniti nell'ordine del file
+typedef struct s_chunk
+{
+	const char	*start;
+	const char	*end;
+	t_element	*elements;
+	size_t		capacity;
+	size_t		count;
+	int			seen;
+	bool		failed;
+	bool		started;
+	pthread_t	thread;
+}	t_chunk;
+
+char		*read_from_file(int fd);
 
-// utility per debug
-void		print_debug_matrix(char **matrix);
+// il parser legge il file una volta sola, riga per riga, e scrive
+// direttamente i t_element: al primo errore stampa la riga e si ferma.
+// per aggiungere una forma: un valore in t_elem_type (minirt_data.h),
+// una riga in g_syntax (scene_parser.c) con l'identificatore e la sua
+// parse_<forma>, e una riga in g_init (renderer/init_math.c)
+// con threads > 1 i file grandi vengono divisi in pezzi fra i thread
+// (scene_parallel.c); se qualcosa non va si rifa' tutto in seriale,
+// cosi' l'errore stampato e' sempre il primo del file
+t_element	*parse_input(const char *path, int threads);
+t_element	*parse_scene(const char *text);
+t_element	*parse_scene_parallel(const char *text, int threads);
+int			parse_line(t_cursor *c, t_element *e);
+size_t		count_lines(const char *s, const char *end);
+void		split_chunks(const char *text, size_t len, t_chunk *ch, int n);
+bool		chunk_arena(t_arena *a, t_chunk *ch, int n);
+void		*chunk_main(void *arg);
 
-// init dei dati
-// i dati sono gia' formattati in modo corretto
-// bisogna modificare anche questo file che infila i dati
-// in t_element nella cascata di if else
+// un elemento per riga, il cursore resta sul '\n' finale
+bool		parse_ambient(t_cursor *c, t_element *e);
+bool		parse_camera(t_cursor *c, t_element *e);
+bool		parse_light(t_cursor *c, t_element *e);
+bool		parse_sphere(t_cursor *c, t_element *e);
+bool		parse_plane(t_cursor *c, t_element *e);
+bool		parse_cylinder(t_cursor *c, t_element *e);
 
-void		init_data_ambient(char *s, t_element *element);
-void		init_data_camera(char *s, t_element *element);
-void		init_data_light(char *s, t_element *element);
-void		init_data_sphere(char *s, t_element *element);
-void		init_data_plane(char *s, t_element *element);
-t_element	*init_data_minirt(char *s);
+// campi: ognuno salta gli spazi prima e finisce su uno spazio o a fine riga
+void		skip_blanks(t_cursor *c);
+bool		at_field_end(const t_cursor *c);
+bool		end_of_line(t_cursor *c);
+bool		parse_error(const t_cursor *c, const char *what, const char *id);
+bool		read_number(t_cursor *c, float *out);
+bool		read_vec3(t_cursor *c, t_vec3 *out);
+bool		read_direction(t_cursor *c, t_vec3 *out);
+bool		read_int(t_cursor *c, int max, int *out);
+bool		read_rgb(t_cursor *c, t_rgb *out);
 
 #endif
@@ -6,7 +6,7 @@
 /*   By: sabruma <sabruma@student.42firenze.it>     +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/06/21 20:22:06 by sabruma           #+#    #+#             */
-/*   Updated: 2025/06/21 20:22:07 by sabruma          ###   ########.fr       */
+/*   Updated: 2026/10/17 23:34:35 by sabruma          ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -14,6 +14,18 @@
 # define MEMORY_H
 # include <stdlib.h>
 
+// allocations are rounded up to this, so each one starts on a cache line
+# define ARENA_ALIGN 64
+
+// bump allocator over one block: arena_alloc carves the next piece,
+// nothing is freed on its own and arena_destroy releases all of it
+typedef struct s_arena
+{
+	unsigned char	*base;
+	size_t			size;
+	size_t			used;
+}	t_arena;
+
 int		ft_memcmp(const void *a1, const void *a2, size_t size);
 void	ft_bzero(void *s, size_t n);
 void	*ft_calloc(size_t nitems, size_t size);
@@ -23,4 +35,9 @@ void	*ft_memcpy(void *to, const void *from, size_t size);
 void	*ft_memmove(void *to, const void *from, size_t size);
 void	*ft_realloc(void *old_ptr, size_t old_size, size_t new_size);
 
+size_t	arena_round(size_t size);
+void	*arena_init(t_arena *a, size_t size);
+void	*arena_alloc(t_arena *a, size_t size);
+void	arena_destroy(t_arena *a);
+
 #endif // MEMORY_H
@@ -0,0 +1,52 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_arena.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: sabruma <sabruma@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:34:34 by sabruma           #+#    #+#             */
+/*   Updated: 2026/10/17 23:34:34 by sabruma          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "libft.h"
+
+size_t	arena_round(size_t size)
+{
+	return ((size + ARENA_ALIGN - 1) / ARENA_ALIGN * ARENA_ALIGN);
+}
+
+// size is the sum of the arena_round of everything that will be carved
+void	*arena_init(t_arena *a, size_t size)
+{
+	size = arena_round(size);
+	if (!size)
+		size = ARENA_ALIGN;
+	*a = (t_arena){.size = size};
+	a->base = aligned_alloc(ARENA_ALIGN, size);
+	if (!a->base)
+		a->size = 0;
+	return (a->base);
+}
+
+// zeroed, ARENA_ALIGN aligned; NULL once the block is used up
+void	*arena_alloc(t_arena *a, size_t size)
+{
+	void	*p;
+
+	size = arena_round(size);
+	if (!a->base || size > a->size - a->used)
+		return (NULL);
+	p = a->base + a->used;
+	a->used += size;
+	ft_bzero(p, size);
+	return (p);
+}
+
+// everything carved from the arena goes away with it
+void	arena_destroy(t_arena *a)
+{
+	free(a->base);
+	*a = (t_arena){0};
+}
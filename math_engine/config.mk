@@ -14,10 +14,19 @@ OBJ_DIR     := $(BUILD_DIR)/obj
 BIN_DIR     := $(BUILD_DIR)/bin
 
 CC          := cc
-# compile with -ffast-math and -march=native to get max math speed
-CFLAGS      := -Wall -Wextra -Werror -std=c99 -O3 -g -march=native #-pedantic #-ffast-math
+# plain x86-64 so the binary runs anywhere, the hot kernels are built
+# for AVX2 / AVX-512 too and picked at startup (src/dispatch)
+CFLAGS      := -Wall -Wextra -Werror -std=c99 -O3 -g #-pedantic #-ffast-math
 INCLUDES    := -I$(INCLUDE_DIR) -I$(INCLUDE_MINIRT_DIR)
+include $(ROOT_DIR)/options.mk
+CFLAGS      += $(MATH_CFLAGS)
+# the out-of-line definitions (src/core) and the tests of them
+OUTLINE_CFLAGS := $(filter-out -DMATH_ENGINE_INLINE,$(CFLAGS))
 # scommentare se si usa gcc
 # LDFLAGS		:= -lm
 AR          := ar
-ARFLAGS     := rcs
\ No newline at end of file
+ARFLAGS     := rcs
+# plain ar can't index the lto objects
+ifneq ($(LTO),0)
+AR          := gcc-ar
+endif
\ No newline at end of file
@@ -6,7 +6,7 @@
 /*   By: sabruma <sabruma@student.42.fr>            +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2026/03/18 18:15:04 by sabruma           #+#    #+#             */
-/*   Updated: 2026/03/31 23:55:01 by sabruma          ###   ########.fr       */
+/*   Updated: 2026/10/18 00:28:25 by sabruma          ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -29,5 +29,33 @@ t_vec3	vec3_gamma_correct(t_vec3 color, float gamma);
 float	vec3_luminance(t_vec3 color);
 // Better for colors?
 t_vec3	vec3_lerp_color(t_vec3 a, t_vec3 b, float t);
+// same as linear_to_srgb(gamma_correct(srgb_to_linear(c), 2)), no powf
+t_vec3	vec3_srgb_gamma2(t_vec3 srgb_color);
+
+// linear -> sRGB without powf. above the linear toe the curve is
+// 1.055 * x^(1/2.4) - 0.055 = 1.055 * t^(5/3) - 0.055 with t = x^(1/4),
+// which is smooth on t in [0.2365, 1] and is replaced by a degree 5
+// minimax polynomial in t. t costs two square roots.
+// max abs error against the exact curve is 7e-6 in float (1/560 of an
+// 8 bit step), input is clamped to [0, 1] first
+# define SRGB_C0 -0.0613405099f
+# define SRGB_C1 0.162028766f
+# define SRGB_C2 1.25539660f
+# define SRGB_C3 -0.577471529f
+# define SRGB_C4 0.289525681f
+# define SRGB_C5 -0.0681455886f
+
+// fast transfer functions: 8 bit sRGB -> linear from a table, and
+// linear -> sRGB as the polynomial above.
+// the _n versions convert whole buffers, SIMD where there is some.
+// linear_to_srgb_n and rgb_pack_n are built per ISA (dispatch/isa.h)
+float	srgb8_to_linear(uint8_t c);
+void	srgb8_to_linear_n(const uint8_t *in, float *out, int n);
+float	linear_to_srgb_fast(float x);
+t_vec3	vec3_linear_to_srgb_fast(t_vec3 linear_color);
+void	linear_to_srgb_n(const float *in, float *out, int n);
+
+// 0x00RRGGBB pixels -> 3 bytes each, R G B: a row of a PPM file
+void	rgb_pack_n(const uint32_t *px, uint8_t *out, int n);
 
 #endif
\ No newline at end of file
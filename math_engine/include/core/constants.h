@@ -6,7 +6,7 @@
 /*   By: sabruma <sabruma@student.42.fr>            +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2026/03/23 00:56:20 by sabruma           #+#    #+#             */
-/*   Updated: 2026/03/30 21:48:43 by sabruma          ###   ########.fr       */
+/*   Updated: 2026/10/18 00:10:20 by sabruma          ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -30,8 +30,14 @@
 // # define VEC3_Y (t_vec3){0.0f, 1.0f, 0.0f}
 // # define VEC3_Z (t_vec3){0.0f, 0.0f, 1.0f}
 
+// vec3_zero and vec3_one come from core/vec3_inline.h when inlined
+# ifndef MATH_ENGINE_INLINE
+
 t_vec3	vec3_zero(void);
 t_vec3	vec3_one(void);
+
+# endif
+
 t_vec3	vec3_x(void);
 t_vec3	vec3_y(void);
 t_vec3	vec3_z(void);
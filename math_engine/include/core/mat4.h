@@ -6,7 +6,7 @@
 /*   By: sabruma <sabruma@student.42.fr>            +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2026/03/18 18:14:36 by sabruma           #+#    #+#             */
-/*   Updated: 2026/03/30 21:51:08 by sabruma          ###   ########.fr       */
+/*   Updated: 2026/10/18 00:37:48 by sabruma          ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -81,6 +81,8 @@ t_mat4	mat4_look_at_fast(t_vec3 eye, t_vec3 forward);
 
 float	mat4_determinant(t_mat4 m);
 t_mat4	mat4_inverse(t_mat4 m);
+t_mat4	mat4_inverse_affine(t_mat4 m);
+t_mat4	mat4_inverse_rigid(t_mat4 m);
 t_mat4	mat4_transpose(t_mat4 m);
 float	mat4_trace(t_mat4 m);
 
@@ -94,11 +96,42 @@ bool	mat4_is_finite(t_mat4 m);
 
 // ===== VECTOR TRANSFORMATIONS =====
 
+# ifdef MATH_ENGINE_INLINE
+#  include "core/mat4_inline.h"
+# else
+
 t_vec3	mat4_transform_point(t_mat4 m, t_vec3 p);
 t_vec3	mat4_transform_vector(t_mat4 m, t_vec3 v);
-t_vec3	mat4_transform_normal(t_mat4 m, t_vec3 n);
 t_vec3	mat4_transform_normal2(t_mat4 m, t_vec3 n);
 
+# endif
+
+t_vec3	mat4_transform_normal(t_mat4 m, t_vec3 n);
+
+// ===== BATCHED TRANSFORMATIONS =====
+// n points / vectors through one matrix, read once and kept in registers.
+// same results as mat4_transform_point / _vector one at a time. points
+// are divided by w only when m isn't affine (mat4_is_affine), normals are
+// vectors through the cached inverse transpose. in and out may be the
+// same arrays
+
+// the three coordinates in separate arrays
+typedef struct s_vec3_soa
+{
+	float	*x;
+	float	*y;
+	float	*z;
+}	t_vec3_soa;
+
+void	mat4_transform_points(const t_mat4 *m, const t_vec3 *in, t_vec3 *out,
+			int n);
+void	mat4_transform_vectors(const t_mat4 *m, const t_vec3 *in, t_vec3 *out,
+			int n);
+void	mat4_transform_points_soa(const t_mat4 *m, const t_vec3_soa *in,
+			const t_vec3_soa *out, int n);
+void	mat4_transform_vectors_soa(const t_mat4 *m, const t_vec3_soa *in,
+			const t_vec3_soa *out, int n);
+
 // ===== DECOMPOSITION =====
 // likely not needed
 
@@ -117,13 +150,9 @@ t_mat4	mat4_lerp(t_mat4 a, t_mat4 b, float t);
 void	mat4_to_float_array(t_mat4 m, float out[16]);
 
 // ===== DO NOT USE, NORMINETTE'S FAULT =====
-//mat4_inverse and _determinant helpers
+//mat4_determinant helper
 
 int		choose_pivot(t_mat4 *m, int i);
-void	eliminate_below_inv(t_mat4 *m, t_mat4 *s, int i);
-void	reduce_diagonal_inv(t_mat4 *m, t_mat4 *s);
-void	eliminate_above_inv(t_mat4 *m, t_mat4 *s);
-int		fwd_elimination_inv(t_mat4 *m, t_mat4 *s);
 
 // ======= Projection Matrices ========
 // not needed in RT because of different camera system from classic 3D rendering
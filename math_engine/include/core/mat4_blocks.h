@@ -0,0 +1,57 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   mat4_blocks.h                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: sabruma <sabruma@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 00:33:53 by sabruma           #+#    #+#             */
+/*   Updated: 2026/10/18 00:37:48 by sabruma          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef MAT4_BLOCKS_H
+# define MAT4_BLOCKS_H
+
+// internal to mat4_inverse: a t_mat4 seen as four 2x2 blocks
+// [A B]
+// [C D], each one register as (m00 m01 m10 m11).
+// A# is the adjugate of A: [a3 -a1] [-a2 a0]
+
+# include "core/vec4.h"
+
+// a * b
+static inline t_vec4	mat2_mul(t_vec4 a, t_vec4 b)
+{
+	return (vec4_add(vec4_mul(a, _mm_shuffle_ps(b, b, _MM_SHUFFLE(3, 0, 3, 0))),
+			vec4_mul(_mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 3, 0, 1)),
+				_mm_shuffle_ps(b, b, _MM_SHUFFLE(1, 2, 1, 2)))));
+}
+
+// a# * b
+static inline t_vec4	mat2_adj_mul(t_vec4 a, t_vec4 b)
+{
+	return (vec4_sub(vec4_mul(_mm_shuffle_ps(a, a, _MM_SHUFFLE(0, 0, 3, 3)), b),
+			vec4_mul(_mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 2, 1, 1)),
+				_mm_shuffle_ps(b, b, _MM_SHUFFLE(1, 0, 3, 2)))));
+}
+
+// a * b#
+static inline t_vec4	mat2_mul_adj(t_vec4 a, t_vec4 b)
+{
+	return (vec4_sub(vec4_mul(a, _mm_shuffle_ps(b, b, _MM_SHUFFLE(0, 3, 0, 3))),
+			vec4_mul(_mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 3, 0, 1)),
+				_mm_shuffle_ps(b, b, _MM_SHUFFLE(1, 2, 1, 2)))));
+}
+
+// |A| |B| |C| |D| from the four rows
+static inline t_vec4	mat4_block_dets(const t_vec4 r[4])
+{
+	return (vec4_sub(
+			vec4_mul(_mm_shuffle_ps(r[0], r[2], _MM_SHUFFLE(2, 0, 2, 0)),
+				_mm_shuffle_ps(r[1], r[3], _MM_SHUFFLE(3, 1, 3, 1))),
+			vec4_mul(_mm_shuffle_ps(r[0], r[2], _MM_SHUFFLE(3, 1, 3, 1)),
+				_mm_shuffle_ps(r[1], r[3], _MM_SHUFFLE(2, 0, 2, 0)))));
+}
+
+#endif
@@ -0,0 +1,46 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   mat4_inline.h                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: sabruma <sabruma@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 00:05:25 by sabruma           #+#    #+#             */
+/*   Updated: 2026/10/18 00:05:25 by sabruma          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef MAT4_INLINE_H
+# define MAT4_INLINE_H
+
+// static inline copies of the mat4_transform_* that don't invert,
+// same rules as core/vec3_inline.h: only mat4.h includes it
+
+static inline t_vec3	mat4_transform_point(t_mat4 m, t_vec3 p)
+{
+	return ((t_vec3){
+		p.x * m.m00 + p.y * m.m10 + p.z * m.m20 + m.m30,
+		p.x * m.m01 + p.y * m.m11 + p.z * m.m21 + m.m31,
+		p.x * m.m02 + p.y * m.m12 + p.z * m.m22 + m.m32
+	});
+}
+
+static inline t_vec3	mat4_transform_vector(t_mat4 m, t_vec3 v)
+{
+	return ((t_vec3){
+		v.x * m.m00 + v.y * m.m10 + v.z * m.m20,
+		v.x * m.m01 + v.y * m.m11 + v.z * m.m21,
+		v.x * m.m02 + v.y * m.m12 + v.z * m.m22
+	});
+}
+
+static inline t_vec3	mat4_transform_normal2(t_mat4 m, t_vec3 n)
+{
+	return ((t_vec3){
+		n.x * m.m00 + n.y * m.m10 + n.z * m.m20,
+		n.x * m.m01 + n.y * m.m11 + n.z * m.m21,
+		n.x * m.m02 + n.y * m.m12 + n.z * m.m22
+	});
+}
+
+#endif
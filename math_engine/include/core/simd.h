@@ -0,0 +1,234 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   simd.h                                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: sabruma <sabruma@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 22:40:41 by sabruma           #+#    #+#             */
+/*   Updated: 2026/10/17 22:54:19 by sabruma          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef SIMD_H
+# define SIMD_H
+
+// thin lane wrappers so batch kernels are written once for every width:
+// 8 lanes with AVX, 4 with SSE2, SIMD_WIDTH 1 means scalar code only.
+// comparisons return lane masks (all bits set where true)
+
+# if defined(__AVX__)
+#  include <immintrin.h>
+#  define SIMD_WIDTH 8
+
+typedef __m256	t_vf;
+
+static inline t_vf	vf_set1(float x)
+{
+	return (_mm256_set1_ps(x));
+}
+
+static inline t_vf	vf_loadu(const float *p)
+{
+	return (_mm256_loadu_ps(p));
+}
+
+static inline void	vf_storeu(float *p, t_vf a)
+{
+	_mm256_storeu_ps(p, a);
+}
+
+static inline t_vf	vf_add(t_vf a, t_vf b)
+{
+	return (_mm256_add_ps(a, b));
+}
+
+static inline t_vf	vf_sub(t_vf a, t_vf b)
+{
+	return (_mm256_sub_ps(a, b));
+}
+
+static inline t_vf	vf_mul(t_vf a, t_vf b)
+{
+	return (_mm256_mul_ps(a, b));
+}
+
+static inline t_vf	vf_div(t_vf a, t_vf b)
+{
+	return (_mm256_div_ps(a, b));
+}
+
+static inline t_vf	vf_sqrt(t_vf a)
+{
+	return (_mm256_sqrt_ps(a));
+}
+
+static inline t_vf	vf_lt(t_vf a, t_vf b)
+{
+	return (_mm256_cmp_ps(a, b, _CMP_LT_OQ));
+}
+
+static inline t_vf	vf_le(t_vf a, t_vf b)
+{
+	return (_mm256_cmp_ps(a, b, _CMP_LE_OQ));
+}
+
+static inline t_vf	vf_eq(t_vf a, t_vf b)
+{
+	return (_mm256_cmp_ps(a, b, _CMP_EQ_OQ));
+}
+
+// a where mask is set, b elsewhere
+static inline t_vf	vf_sel(t_vf mask, t_vf a, t_vf b)
+{
+	return (_mm256_blendv_ps(b, a, mask));
+}
+
+static inline t_vf	vf_or(t_vf a, t_vf b)
+{
+	return (_mm256_or_ps(a, b));
+}
+
+static inline t_vf	vf_and(t_vf a, t_vf b)
+{
+	return (_mm256_and_ps(a, b));
+}
+
+static inline int	vf_movemask(t_vf mask)
+{
+	return (_mm256_movemask_ps(mask));
+}
+
+// 0, 1, 2 ... as floats, to mask the lanes past the end of a batch
+static inline t_vf	vf_lanes(void)
+{
+	return (_mm256_setr_ps(0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f));
+}
+
+// minimum of the lanes, NaN lanes must be cleared before
+static inline float	vf_hmin(t_vf a)
+{
+	__m128	m;
+
+	m = _mm_min_ps(_mm256_castps256_ps128(a), _mm256_extractf128_ps(a, 1));
+	m = _mm_min_ps(m, _mm_shuffle_ps(m, m, _MM_SHUFFLE(1, 0, 3, 2)));
+	m = _mm_min_ps(m, _mm_shuffle_ps(m, m, _MM_SHUFFLE(2, 3, 0, 1)));
+	return (_mm_cvtss_f32(m));
+}
+
+# elif defined(__SSE2__)
+#  include <emmintrin.h>
+#  define SIMD_WIDTH 4
+
+typedef __m128	t_vf;
+
+static inline t_vf	vf_set1(float x)
+{
+	return (_mm_set1_ps(x));
+}
+
+static inline t_vf	vf_loadu(const float *p)
+{
+	return (_mm_loadu_ps(p));
+}
+
+static inline void	vf_storeu(float *p, t_vf a)
+{
+	_mm_storeu_ps(p, a);
+}
+
+static inline t_vf	vf_add(t_vf a, t_vf b)
+{
+	return (_mm_add_ps(a, b));
+}
+
+static inline t_vf	vf_sub(t_vf a, t_vf b)
+{
+	return (_mm_sub_ps(a, b));
+}
+
+static inline t_vf	vf_mul(t_vf a, t_vf b)
+{
+	return (_mm_mul_ps(a, b));
+}
+
+static inline t_vf	vf_div(t_vf a, t_vf b)
+{
+	return (_mm_div_ps(a, b));
+}
+
+static inline t_vf	vf_sqrt(t_vf a)
+{
+	return (_mm_sqrt_ps(a));
+}
+
+static inline t_vf	vf_lt(t_vf a, t_vf b)
+{
+	return (_mm_cmplt_ps(a, b));
+}
+
+static inline t_vf	vf_le(t_vf a, t_vf b)
+{
+	return (_mm_cmple_ps(a, b));
+}
+
+static inline t_vf	vf_eq(t_vf a, t_vf b)
+{
+	return (_mm_cmpeq_ps(a, b));
+}
+
+// a where mask is set, b elsewhere (no blendv before SSE4.1)
+static inline t_vf	vf_sel(t_vf mask, t_vf a, t_vf b)
+{
+	return (_mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b)));
+}
+
+static inline t_vf	vf_or(t_vf a, t_vf b)
+{
+	return (_mm_or_ps(a, b));
+}
+
+static inline t_vf	vf_and(t_vf a, t_vf b)
+{
+	return (_mm_and_ps(a, b));
+}
+
+static inline int	vf_movemask(t_vf mask)
+{
+	return (_mm_movemask_ps(mask));
+}
+
+static inline t_vf	vf_lanes(void)
+{
+	return (_mm_setr_ps(0.0f, 1.0f, 2.0f, 3.0f));
+}
+
+static inline float	vf_hmin(t_vf a)
+{
+	a = _mm_min_ps(a, _mm_shuffle_ps(a, a, _MM_SHUFFLE(1, 0, 3, 2)));
+	a = _mm_min_ps(a, _mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 3, 0, 1)));
+	return (_mm_cvtss_f32(a));
+}
+
+# else
+#  define SIMD_WIDTH 1
+# endif
+
+# if SIMD_WIDTH > 1
+
+// first lane holding the minimum when it's below *bound, which it replaces,
+// -1 otherwise. NaN lanes must be cleared before
+static inline int	vf_argmin_below(t_vf a, float *bound)
+{
+	float	m;
+
+	m = vf_hmin(a);
+	if (!(m < *bound))
+		return (-1);
+	*bound = m;
+	return (__builtin_ctz(vf_movemask(vf_eq(a, vf_set1(m)))));
+}
+
+# endif
+
+#endif
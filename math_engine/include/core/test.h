@@ -35,6 +35,10 @@ void	test_vec3_normalize(void);
 void	test_vec3_product(void);
 void	test_vec3_project_distance(void);
 
+// ====== VEC4 ======
+
+void	test_vec4(void);
+
 // ====== MAT4 ======
 
 void	test_mat4_basic(void);
@@ -44,6 +48,14 @@ void	test_mat4_special(void);
 void	test_mat4_transform(void);
 void	test_mat4_transformation(void);
 
+// ====== COLOR ======
+
+void	test_color_transfer(void);
+
+// ====== PARSE ======
+
+void	test_parse_float(void);
+
 // ====== UTILS ======
 
 bool	float_equal(float a, float b, float eps);
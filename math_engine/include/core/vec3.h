@@ -6,7 +6,7 @@
 /*   By: sabruma <sabruma@student.42.fr>            +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2026/03/18 18:11:07 by sabruma           #+#    #+#             */
-/*   Updated: 2026/03/30 20:16:36 by sabruma          ###   ########.fr       */
+/*   Updated: 2026/10/18 00:10:20 by sabruma          ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -43,7 +43,13 @@ typedef struct s_vec2
 #  define _GNU_SOURCE
 # endif
 
-// ===== CORE CREATION & BASIC OPERATIONS =====
+// ===== HOT PATH =====
+// static inline with MATH_ENGINE_INLINE (make MATH_INLINE=1, the default),
+// see core/vec3_inline.h. the library always has them out of line
+
+# ifdef MATH_ENGINE_INLINE
+#  include "core/vec3_inline.h"
+# else
 
 t_vec3	vec3_new(float x, float y, float z);
 t_vec3	vec3_from_scalar(float s);
@@ -55,22 +61,31 @@ t_vec3	vec3_scale(t_vec3 v, float s);
 
 float	vec3_dot(t_vec3 a, t_vec3 b);
 t_vec3	vec3_cross(t_vec3 a, t_vec3 b);
-float	vec3_volume(t_vec3 a, t_vec3 b, t_vec3 c);
-t_vec3	vec3_triple(t_vec3 a, t_vec3 b, t_vec3 c);
-
-// ===== COMPONENT-WISE OPERATIONS =====
 
 t_vec3	vec3_mul_comp(t_vec3 a, t_vec3 b);
 t_vec3	vec3_div_comp(t_vec3 a, t_vec3 b);
 t_vec3	vec3_min_comp(t_vec3 a, t_vec3 b);
 t_vec3	vec3_max_comp(t_vec3 a, t_vec3 b);
 
-// ===== LENGTH & NORMALIZATION =====
-
 float	vec3_length(t_vec3 v);
 float	vec3_length_sq(t_vec3 v);
-
 t_vec3	vec3_normalize(t_vec3 v);
+
+float	vec3_distance(t_vec3 a, t_vec3 b);
+float	vec3_distance_sq(t_vec3 a, t_vec3 b);
+
+t_vec3	vec3_project(t_vec3 v, t_vec3 onto);
+t_vec3	vec3_reject(t_vec3 v, t_vec3 onto);
+
+# endif
+
+// ===== CORE CREATION & BASIC OPERATIONS =====
+
+float	vec3_volume(t_vec3 a, t_vec3 b, t_vec3 c);
+t_vec3	vec3_triple(t_vec3 a, t_vec3 b, t_vec3 c);
+
+// ===== LENGTH & NORMALIZATION =====
+
 t_vec3	vec3_normalize_or(t_vec3 v, t_vec3 fallback);
 bool	vec3_is_normalized(t_vec3 v);
 
@@ -86,15 +101,8 @@ bool	vec3_is_perpendicular(t_vec3 a, t_vec3 b, float epsilon);
 void	vec3_coordinate_system(t_vec3 a, t_vec3 *b, t_vec3 *c);
 void	vec3_orthonormal_basis(t_vec3 n, t_vec3 *t, t_vec3 *b);
 
-// ===== PROJECTIONS =====
-
-t_vec3	vec3_project(t_vec3 v, t_vec3 onto);
-t_vec3	vec3_reject(t_vec3 v, t_vec3 onto);
-
 // ===== POINT-SPECIFIC =====
 
-float	vec3_distance(t_vec3 a, t_vec3 b);
-float	vec3_distance_sq(t_vec3 a, t_vec3 b);
 // t_vec3 vec3_midpoint(t_vec3 a, t_vec3 b);
 // t_vec3 vec3_barycentric(t_vec3 a, t_vec3 b, t_vec3 c, float u, float v);
 t_vec3	vec3_barycentric(t_vec2 a, t_vec2 b, t_vec2 c, t_vec2 p);
@@ -0,0 +1,139 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   vec3_inline.h                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: sabruma <sabruma@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 00:05:25 by sabruma           #+#    #+#             */
+/*   Updated: 2026/10/18 00:05:25 by sabruma          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef VEC3_INLINE_H
+# define VEC3_INLINE_H
+
+// make MATH_INLINE=1 (the default): the hot vec3 functions as static
+// inline copies of src/core, so the intersection code keeps its vectors
+// in registers instead of passing structs through a call each time.
+// only vec3.h includes it. src/core and the tests build without
+// MATH_ENGINE_INLINE, the library still exports every function
+
+# include <math.h>
+
+static inline t_vec3	vec3_new(float x, float y, float z)
+{
+	return ((t_vec3){x, y, z});
+}
+
+static inline t_vec3	vec3_from_scalar(float s)
+{
+	return ((t_vec3){s, s, s});
+}
+
+static inline t_vec3	vec3_zero(void)
+{
+	return ((t_vec3){0.0f, 0.0f, 0.0f});
+}
+
+static inline t_vec3	vec3_one(void)
+{
+	return ((t_vec3){1.0f, 1.0f, 1.0f});
+}
+
+static inline t_vec3	vec3_add(t_vec3 a, t_vec3 b)
+{
+	return ((t_vec3){a.x + b.x, a.y + b.y, a.z + b.z});
+}
+
+static inline t_vec3	vec3_sub(t_vec3 a, t_vec3 b)
+{
+	return ((t_vec3){a.x - b.x, a.y - b.y, a.z - b.z});
+}
+
+static inline t_vec3	vec3_neg(t_vec3 v)
+{
+	return ((t_vec3){-v.x, -v.y, -v.z});
+}
+
+static inline t_vec3	vec3_scale(t_vec3 v, float s)
+{
+	return ((t_vec3){v.x * s, v.y * s, v.z * s});
+}
+
+static inline float	vec3_dot(t_vec3 a, t_vec3 b)
+{
+	return (a.x * b.x + a.y * b.y + a.z * b.z);
+}
+
+static inline t_vec3	vec3_cross(t_vec3 a, t_vec3 b)
+{
+	return ((t_vec3){
+		a.y * b.z - a.z * b.y,
+		a.z * b.x - a.x * b.z,
+		a.x * b.y - a.y * b.x
+	});
+}
+
+static inline t_vec3	vec3_mul_comp(t_vec3 a, t_vec3 b)
+{
+	return ((t_vec3){a.x * b.x, a.y * b.y, a.z * b.z});
+}
+
+static inline t_vec3	vec3_div_comp(t_vec3 a, t_vec3 b)
+{
+	return ((t_vec3){a.x / b.x, a.y / b.y, a.z / b.z});
+}
+
+static inline t_vec3	vec3_min_comp(t_vec3 a, t_vec3 b)
+{
+	return ((t_vec3){fminf(a.x, b.x), fminf(a.y, b.y), fminf(a.z, b.z)});
+}
+
+static inline t_vec3	vec3_max_comp(t_vec3 a, t_vec3 b)
+{
+	return ((t_vec3){fmaxf(a.x, b.x), fmaxf(a.y, b.y), fmaxf(a.z, b.z)});
+}
+
+static inline float	vec3_length_sq(t_vec3 v)
+{
+	return (vec3_dot(v, v));
+}
+
+static inline float	vec3_length(t_vec3 v)
+{
+	return (sqrtf(vec3_dot(v, v)));
+}
+
+static inline t_vec3	vec3_normalize(t_vec3 v)
+{
+	return (vec3_scale(v, 1.0f / sqrtf(vec3_length_sq(v))));
+}
+
+static inline float	vec3_distance_sq(t_vec3 a, t_vec3 b)
+{
+	return (vec3_length_sq(vec3_sub(a, b)));
+}
+
+static inline float	vec3_distance(t_vec3 a, t_vec3 b)
+{
+	return (vec3_length(vec3_sub(a, b)));
+}
+
+// 1e-4f is math_epsilon_sq(), a call here would undo the point
+static inline t_vec3	vec3_project(t_vec3 v, t_vec3 onto)
+{
+	float	len_sq;
+
+	len_sq = vec3_length_sq(onto);
+	if (len_sq > 1e-4f)
+		return (vec3_scale(onto, vec3_dot(v, onto) / len_sq));
+	return (vec3_zero());
+}
+
+static inline t_vec3	vec3_reject(t_vec3 v, t_vec3 onto)
+{
+	return (vec3_sub(v, vec3_project(v, onto)));
+}
+
+#endif
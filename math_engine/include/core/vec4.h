@@ -0,0 +1,211 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   vec4.h                                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: sabruma <sabruma@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 00:11:44 by sabruma           #+#    #+#             */
+/*   Updated: 2026/10/18 01:19:49 by sabruma          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef VEC4_H
+# define VEC4_H
+
+// a t_vec3 padded to one SSE register: x y z plus w, 1 for points and
+// 0 for directions. the functions work on x y z like their vec3 twins
+// (w goes along, never into a result), dot, cross and min/max round
+// exactly like vec3, normalize trades the division for rsqrt plus a
+// Newton step (about 1e-7 relative error). code that takes t_vec3 by value
+// converts at the edges with vec4_load3 / vec4_to_vec3 and keeps its
+// signature. every x86-64 has SSE2
+
+# include "core/mat4.h"
+
+# ifndef __SSE2__
+#  error "core/vec4.h needs SSE2"
+# endif
+# include <immintrin.h>
+
+typedef __m128	t_vec4;
+
+static inline t_vec4	vec4_from_vec3(t_vec3 v, float w)
+{
+	return (_mm_setr_ps(v.x, v.y, v.z, w));
+}
+
+// two loads, never past the end of *p, w = 0. __m128i may alias
+// anything, a double * would not
+static inline t_vec4	vec4_load3(const t_vec3 *p)
+{
+	__m128	xy;
+
+	xy = _mm_castsi128_ps(_mm_loadl_epi64((const __m128i *)p));
+	return (_mm_movelh_ps(xy, _mm_load_ss(&p->z)));
+}
+
+static inline t_vec3	vec4_to_vec3(t_vec4 v)
+{
+	float	f[4] __attribute__((aligned(16)));
+
+	_mm_store_ps(f, v);
+	return ((t_vec3){f[0], f[1], f[2]});
+}
+
+// x y z to *p, nothing written past it
+static inline void	vec4_store3(t_vec3 *p, t_vec4 v)
+{
+	_mm_storel_epi64((__m128i *)p, _mm_castps_si128(v));
+	_mm_store_ss(&p->z, _mm_movehl_ps(v, v));
+}
+
+static inline t_vec4	vec4_splat(float s)
+{
+	return (_mm_set1_ps(s));
+}
+
+static inline t_vec4	vec4_add(t_vec4 a, t_vec4 b)
+{
+	return (_mm_add_ps(a, b));
+}
+
+static inline t_vec4	vec4_sub(t_vec4 a, t_vec4 b)
+{
+	return (_mm_sub_ps(a, b));
+}
+
+static inline t_vec4	vec4_mul(t_vec4 a, t_vec4 b)
+{
+	return (_mm_mul_ps(a, b));
+}
+
+static inline t_vec4	vec4_scale(t_vec4 v, float s)
+{
+	return (_mm_mul_ps(v, _mm_set1_ps(s)));
+}
+
+// (x + y) + z in the first lane, in the order of vec3_dot
+static inline t_vec4	vec4_dot_lane(t_vec4 a, t_vec4 b)
+{
+	__m128	m;
+	__m128	s;
+
+	m = _mm_mul_ps(a, b);
+	s = _mm_add_ss(m, _mm_shuffle_ps(m, m, _MM_SHUFFLE(1, 1, 1, 1)));
+	return (_mm_add_ss(s, _mm_movehl_ps(m, m)));
+}
+
+static inline float	vec4_dot(t_vec4 a, t_vec4 b)
+{
+	return (_mm_cvtss_f32(vec4_dot_lane(a, b)));
+}
+
+// a.yzx * b.zxy - a.zxy * b.yzx, w ends up 0
+static inline t_vec4	vec4_cross(t_vec4 a, t_vec4 b)
+{
+	__m128	l;
+	__m128	r;
+
+	l = _mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 0, 2, 1)),
+			_mm_shuffle_ps(b, b, _MM_SHUFFLE(3, 1, 0, 2)));
+	r = _mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 1, 0, 2)),
+			_mm_shuffle_ps(b, b, _MM_SHUFFLE(3, 0, 2, 1)));
+	return (_mm_sub_ps(l, r));
+}
+
+// 1 / sqrt(d) from the 12 bit estimate, one Newton step:
+// r' = r * (1.5 - 0.5 * d * r * r)
+static inline t_vec4	vec4_rsqrt(t_vec4 d)
+{
+	__m128	r;
+	__m128	drr;
+
+	r = _mm_rsqrt_ps(d);
+	drr = _mm_mul_ps(_mm_mul_ps(d, r), r);
+	return (_mm_mul_ps(r, _mm_sub_ps(_mm_set1_ps(1.5f),
+				_mm_mul_ps(_mm_set1_ps(0.5f), drr))));
+}
+
+// same as vec3_normalize for zero length: inf or NaN
+static inline t_vec4	vec4_normalize(t_vec4 v)
+{
+	__m128	d;
+
+	d = vec4_dot_lane(v, v);
+	return (_mm_mul_ps(v, vec4_rsqrt(_mm_shuffle_ps(d, d, 0))));
+}
+
+static inline float	vec4_length(t_vec4 v)
+{
+	return (_mm_cvtss_f32(_mm_sqrt_ss(vec4_dot_lane(v, v))));
+}
+
+// lane by lane, b where either one is NaN
+static inline t_vec4	vec4_min(t_vec4 a, t_vec4 b)
+{
+	return (_mm_min_ps(a, b));
+}
+
+static inline t_vec4	vec4_max(t_vec4 a, t_vec4 b)
+{
+	return (_mm_max_ps(a, b));
+}
+
+// a where mask is set, b elsewhere
+static inline t_vec4	vec4_select(t_vec4 mask, t_vec4 a, t_vec4 b)
+{
+	return (_mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b)));
+}
+
+// min / max of x y z, the lanes must not be NaN
+static inline float	vec4_hmin3(t_vec4 v)
+{
+	__m128	m;
+
+	m = _mm_min_ss(v, _mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 1, 1, 1)));
+	return (_mm_cvtss_f32(_mm_min_ss(m, _mm_movehl_ps(v, v))));
+}
+
+static inline float	vec4_hmax3(t_vec4 v)
+{
+	__m128	m;
+
+	m = _mm_max_ss(v, _mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 1, 1, 1)));
+	return (_mm_cvtss_f32(_mm_max_ss(m, _mm_movehl_ps(v, v))));
+}
+
+// ===== MAT4 =====
+// the rows of t_mat4 are the images of x, y, z and the translation:
+// m * p = x * row0 + y * row1 + z * row2 (+ row3 for points), summed in
+// the order of mat4_transform_*. m is read in place, not copied
+
+static inline t_vec4	mat4_row4(const t_mat4 *m, int row)
+{
+	return (_mm_loadu_ps(m->arr + 4 * row));
+}
+
+static inline t_vec4	mat4_transform_vector4(const t_mat4 *m, t_vec4 v)
+{
+	__m128	r;
+
+	r = _mm_mul_ps(_mm_shuffle_ps(v, v, 0x00), mat4_row4(m, 0));
+	r = _mm_add_ps(r, _mm_mul_ps(_mm_shuffle_ps(v, v, 0x55),
+				mat4_row4(m, 1)));
+	return (_mm_add_ps(r, _mm_mul_ps(_mm_shuffle_ps(v, v, 0xaa),
+				mat4_row4(m, 2))));
+}
+
+// w of the result is the w of the matrix columns, 1 for affine ones
+static inline t_vec4	mat4_transform_point4(const t_mat4 *m, t_vec4 p)
+{
+	return (_mm_add_ps(mat4_transform_vector4(m, p), mat4_row4(m, 3)));
+}
+
+// m is the cached inverse transpose, like mat4_transform_normal2
+static inline t_vec4	mat4_transform_normal4(const t_mat4 *m, t_vec4 n)
+{
+	return (mat4_transform_vector4(m, n));
+}
+
+#endif
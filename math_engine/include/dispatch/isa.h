@@ -0,0 +1,36 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   isa.h                                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: sabruma <sabruma@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 00:19:17 by sabruma           #+#    #+#             */
+/*   Updated: 2026/10/18 00:31:39 by sabruma          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef ISA_H
+# define ISA_H
+
+# include <stdbool.h>
+
+// instruction set the hot kernels run with: intersection batches and
+// packets, sRGB encoding, pixel packing and SoA transforms. the library
+// is built for plain x86-64 (SSE2) and each kernel once more per level
+// below, one is picked at startup. ISA_AUTO is the best level this cpu has
+typedef enum e_isa
+{
+	ISA_AUTO,
+	ISA_SSE2,
+	ISA_AVX2,
+	ISA_AVX512
+}	t_isa;
+
+t_isa		isa_detect(void);
+int			isa_select(t_isa isa);
+t_isa		isa_current(void);
+const char	*isa_name(t_isa isa);
+bool		isa_parse(const char *s, t_isa *isa);
+
+#endif
@@ -0,0 +1,82 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   isa_kernels.h                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: sabruma <sabruma@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 00:19:17 by sabruma           #+#    #+#             */
+/*   Updated: 2026/10/18 00:31:39 by sabruma          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef ISA_KERNELS_H
+# define ISA_KERNELS_H
+
+# include <stdint.h>
+# include "dispatch/isa.h"
+# include "geometry/sphere_soa.h"
+# include "geometry/ray_packet.h"
+# include "core/mat4.h"
+
+// private to src/dispatch: one table per level, the public kernels
+// (sphere_intersect_n, packet_aabb ...) call through the selected one
+typedef struct s_isa_kernels
+{
+	int		(*sphere_n)(const t_sphere_soa *, const t_ray *, const int[2],
+			float *);
+	int		(*sphere_packet)(const t_sphere_soa *, int, t_ray_packet *);
+	int		(*plane_packet)(const t_plane_math *, t_ray_packet *);
+	int		(*packet_aabb)(const t_aabb *, const t_ray_packet *, float *);
+	void	(*srgb_n)(const float *, float *, int);
+	void	(*rgb_pack)(const uint32_t *, uint8_t *, int);
+	void	(*points_soa)(const t_mat4 *, const t_vec3_soa *,
+			const t_vec3_soa *, int);
+	void	(*vectors_soa)(const t_mat4 *, const t_vec3_soa *,
+			const t_vec3_soa *, int);
+}	t_isa_kernels;
+
+const t_isa_kernels	*isa_kernels(void);
+
+// the kernel sources built with -D<name>=<name>_<level>
+int		sphere_intersect_n_sse2(const t_sphere_soa *soa, const t_ray *ray,
+			const int range[2], float *t);
+int		sphere_packet_sse2(const t_sphere_soa *soa, int i, t_ray_packet *p);
+int		plane_packet_sse2(const t_plane_math *pl, t_ray_packet *p);
+int		packet_aabb_sse2(const t_aabb *box, const t_ray_packet *p,
+			float *t_near);
+void	linear_to_srgb_n_sse2(const float *in, float *out, int n);
+void	rgb_pack_n_sse2(const uint32_t *px, uint8_t *out, int n);
+void	mat4_transform_points_soa_sse2(const t_mat4 *m,
+			const t_vec3_soa *in, const t_vec3_soa *out, int n);
+void	mat4_transform_vectors_soa_sse2(const t_mat4 *m,
+			const t_vec3_soa *in, const t_vec3_soa *out, int n);
+
+int		sphere_intersect_n_avx2(const t_sphere_soa *soa, const t_ray *ray,
+			const int range[2], float *t);
+int		sphere_packet_avx2(const t_sphere_soa *soa, int i, t_ray_packet *p);
+int		plane_packet_avx2(const t_plane_math *pl, t_ray_packet *p);
+int		packet_aabb_avx2(const t_aabb *box, const t_ray_packet *p,
+			float *t_near);
+void	linear_to_srgb_n_avx2(const float *in, float *out, int n);
+void	rgb_pack_n_avx2(const uint32_t *px, uint8_t *out, int n);
+void	mat4_transform_points_soa_avx2(const t_mat4 *m,
+			const t_vec3_soa *in, const t_vec3_soa *out, int n);
+void	mat4_transform_vectors_soa_avx2(const t_mat4 *m,
+			const t_vec3_soa *in, const t_vec3_soa *out, int n);
+
+int		sphere_intersect_n_avx512(const t_sphere_soa *soa, const t_ray *ray,
+			const int range[2], float *t);
+int		sphere_packet_avx512(const t_sphere_soa *soa, int i,
+			t_ray_packet *p);
+int		plane_packet_avx512(const t_plane_math *pl, t_ray_packet *p);
+int		packet_aabb_avx512(const t_aabb *box, const t_ray_packet *p,
+			float *t_near);
+void	linear_to_srgb_n_avx512(const float *in, float *out, int n);
+void	rgb_pack_n_avx512(const uint32_t *px, uint8_t *out, int n);
+void	mat4_transform_points_soa_avx512(const t_mat4 *m,
+			const t_vec3_soa *in, const t_vec3_soa *out, int n);
+void	mat4_transform_vectors_soa_avx512(const t_mat4 *m,
+			const t_vec3_soa *in, const t_vec3_soa *out, int n);
+
+#endif
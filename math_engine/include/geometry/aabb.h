@@ -0,0 +1,37 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   aabb.h                                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: sabruma <sabruma@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 22:26:50 by sabruma           #+#    #+#             */
+/*   Updated: 2026/10/17 22:26:50 by sabruma          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef AABB_H
+# define AABB_H
+
+# include <stdbool.h>
+# include "core/vec3.h"
+# include "geometry/ray.h"
+
+// relative padding of primitive bounds, keeps grazing hits inside the box
+# define AABB_EPSILON 1e-4f
+
+// axis-aligned box, empty when min > max on any axis
+typedef struct s_aabb
+{
+	t_vec3	min;
+	t_vec3	max;
+}	t_aabb;
+
+t_aabb	aabb_empty(void);
+t_aabb	aabb_union(t_aabb a, t_aabb b);
+t_aabb	aabb_grow(t_aabb box, t_vec3 p);
+float	aabb_area(t_aabb box);
+bool	aabb_intersect(const t_aabb *box, const t_ray *ray, t_vec3 inv_dir,
+			float *t_near);
+
+#endif
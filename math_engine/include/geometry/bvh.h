@@ -0,0 +1,93 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bvh.h                                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: sabruma <sabruma@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 22:26:50 by sabruma           #+#    #+#             */
+/*   Updated: 2026/10/17 23:35:21 by sabruma          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef BVH_H
+# define BVH_H
+
+# include "geometry/aabb.h"
+# include "geometry/intersection.h"
+
+# define BVH_BINS 12
+# define BVH_LEAF_SIZE 8
+# define BVH_MAX_DEPTH 60
+// a traversal never holds more than BVH_MAX_DEPTH + 1 pending nodes
+# define BVH_STACK 64
+
+// which primitive array and which slot a leaf entry points to
+typedef struct s_bvh_ref
+{
+	t_obj_type	obj;
+	int			idx;
+}	t_bvh_ref;
+
+// build input, reordered in place by bvh_build
+typedef struct s_bvh_prim
+{
+	t_aabb		box;
+	t_vec3		centroid;
+	t_bvh_ref	ref;
+}	t_bvh_prim;
+
+// 32 bytes: with count == 0 it's an inner node whose children are
+// nodes[first] and nodes[first + 1], otherwise a leaf over
+// refs[first] .. refs[first + count - 1]
+typedef struct s_bvh_node
+{
+	t_aabb	box;
+	int		first;
+	int		count;
+}	t_bvh_node;
+
+typedef struct s_bvh
+{
+	t_bvh_node	*nodes;
+	t_bvh_ref	*refs;
+	int			node_count;
+	int			ref_count;
+}	t_bvh;
+
+// ===== BUILD INTERNALS =====
+
+typedef struct s_bvh_bin
+{
+	t_aabb	box;
+	int		count;
+}	t_bvh_bin;
+
+// centroids are binned along axis as (c - min) * scale,
+// primitives in bins before bin go to the left child
+typedef struct s_bvh_split
+{
+	int		axis;
+	int		bin;
+	float	min;
+	float	scale;
+	float	cost;
+}	t_bvh_split;
+
+typedef struct s_bvh_builder
+{
+	t_bvh		*bvh;
+	t_bvh_prim	*prims;
+}	t_bvh_builder;
+
+t_bvh_prim	bvh_prim(t_aabb box, t_bvh_ref ref);
+void		bvh_build(t_bvh *bvh, t_bvh_prim *prims, int count);
+
+bool		bvh_find_split(const t_bvh_prim *prims, int count, t_aabb cbox,
+				t_bvh_split *best);
+float		bvh_axis(t_vec3 v, int axis);
+int			bvh_bin(const t_bvh_split *split, t_vec3 centroid);
+int			bvh_partition(t_bvh_prim *prims, int count,
+				const t_bvh_split *split);
+
+#endif
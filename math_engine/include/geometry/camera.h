@@ -6,7 +6,7 @@
 /*   By: sabruma <sabruma@student.42firenze.it>     +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2026/03/18 18:19:15 by sabruma           #+#    #+#             */
-/*   Updated: 2026/03/18 18:20:41 by sabruma          ###   ########.fr       */
+/*   Updated: 2026/10/18 00:37:48 by sabruma          ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -20,6 +20,7 @@
 typedef struct s_camera_math
 {
 	t_mat4	cam_to_world;
+	t_mat4	world_to_cam;	// inverse of cam_to_world, kept with it
 
 	float	near_clip;
 	float	far_clip;
@@ -30,6 +31,10 @@ typedef struct s_camera_math
 	float	zoom;
 	float	canvas[4];
 	float	image_aspect;
+
+	t_vec3	plane_origin;	// eye to the top-left corner of the image plane
+	t_vec3	du;				// one pixel right on the image plane
+	t_vec3	dv;				// one pixel down
 }	t_camera_math;
 
 // ^
@@ -62,8 +67,28 @@ typedef struct s_pixel
 
 # endif
 
+// longest run of pixels camera_row fills in one call
+# define CAMERA_ROW 64
+
+// primary rays of count pixels on one row, directions laid out per field.
+// they all share the eye and the clip range of the camera
+typedef struct s_ray_row
+{
+	float	dx[CAMERA_ROW];
+	float	dy[CAMERA_ROW];
+	float	dz[CAMERA_ROW];
+	t_vec3	origin;
+	float	t_min;
+	float	t_max;
+	int		count;
+}	t_ray_row;
+
 int		camera_init(t_camera_math *cam, t_camera_data data);
+void	camera_resize(t_camera_math *cam, int width, int height);
 t_ray	camera_raygen(const t_camera_math *cam, t_pixel p);
+void	camera_row(const t_camera_math *cam, t_pixel start, int count,
+			t_ray_row *row);
+t_ray	camera_row_ray(const t_ray_row *row, int i);
 t_vec3	camera_eye(const t_camera_math *cam);
 
 #endif
\ No newline at end of file
@@ -6,7 +6,7 @@
 /*   By: sabruma <sabruma@student.42firenze.it>     +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2026/03/18 18:25:17 by sabruma           #+#    #+#             */
-/*   Updated: 2026/03/23 00:57:59 by sabruma          ###   ########.fr       */
+/*   Updated: 2026/10/17 22:38:53 by sabruma          ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -15,6 +15,7 @@
 
 # include "core/vec3.h"
 # include "geometry/intersection.h"
+# include "geometry/aabb.h"
 # include "geometry/plane.h"
 
 typedef struct s_cylinder_math
@@ -45,5 +46,10 @@ typedef struct s_cylinder_data
 
 int		cylinder_init(t_cylinder_math *cy, t_cylinder_data data);
 bool	cylinder_intersect(t_cylinder_math *c, t_ray ray, t_hit *hit);
+bool	cylinder_intersect_t(const t_cylinder_math *c, const t_ray *ray,
+			float *t);
+void	cylinder_finalize(const t_cylinder_math *c, const t_ray *ray, float t,
+			t_hit *hit);
+t_aabb	cylinder_bounds(const t_cylinder_math *c);
 
 #endif
\ No newline at end of file
@@ -0,0 +1,54 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   packet_lanes.h                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: sabruma <sabruma@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 22:47:56 by sabruma           #+#    #+#             */
+/*   Updated: 2026/10/17 22:47:56 by sabruma          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef PACKET_LANES_H
+# define PACKET_LANES_H
+
+// internal to the packet kernels, same caveat as sphere_lanes.h
+
+# include "geometry/ray_packet.h"
+# include "geometry/sphere_lanes.h"
+
+# if SIMD_WIDTH > 1
+
+// rays from lane g on, a = |direction|² like sphere_intersect_t
+static inline void	packet_lanes(const t_ray_packet *p, int g, t_ray_lanes *r)
+{
+	r->ox = vf_loadu(p->ox + g);
+	r->oy = vf_loadu(p->oy + g);
+	r->oz = vf_loadu(p->oz + g);
+	r->dx = vf_loadu(p->dx + g);
+	r->dy = vf_loadu(p->dy + g);
+	r->dz = vf_loadu(p->dz + g);
+	r->a = vf_add(vf_add(vf_mul(r->dx, r->dx), vf_mul(r->dy, r->dy)),
+			vf_mul(r->dz, r->dz));
+	r->t_min = vf_loadu(p->t_min + g);
+	r->t_max = vf_loadu(p->t_max + g);
+	r->eps = vf_set1(math_epsilon());
+}
+
+// keeps t on the lanes where it beats the closest hit, like trace does
+static inline int	packet_keep(t_vf t, t_ray_packet *p, int g)
+{
+	t_vf	best;
+	t_vf	closer;
+
+	best = vf_loadu(p->best + g);
+	closer = vf_lt(t, best);
+	vf_storeu(p->best + g, vf_sel(closer, t, best));
+	vf_storeu(p->t_max + g, vf_sel(closer, t, vf_loadu(p->t_max + g)));
+	return (vf_movemask(closer));
+}
+
+# endif
+
+#endif
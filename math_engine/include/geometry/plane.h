@@ -6,7 +6,7 @@
 /*   By: sabruma <sabruma@student.42firenze.it>     +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2026/03/18 18:25:22 by sabruma           #+#    #+#             */
-/*   Updated: 2026/03/23 00:57:14 by sabruma          ###   ########.fr       */
+/*   Updated: 2026/10/17 22:38:53 by sabruma          ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -33,5 +33,8 @@ typedef struct s_plane_data
 
 int		plane_init(t_plane_math *pl, t_plane_data data);
 bool	plane_intersect(t_plane_math *p, t_ray ray, t_hit *hit);
+bool	plane_intersect_t(const t_plane_math *p, const t_ray *ray, float *t);
+void	plane_finalize(const t_plane_math *p, const t_ray *ray, float t,
+			t_hit *hit);
 
 #endif
\ No newline at end of file
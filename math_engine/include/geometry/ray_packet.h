@@ -0,0 +1,54 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ray_packet.h                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: sabruma <sabruma@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 22:47:09 by sabruma           #+#    #+#             */
+/*   Updated: 2026/10/17 22:47:09 by sabruma          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef RAY_PACKET_H
+# define RAY_PACKET_H
+
+# include "geometry/aabb.h"
+# include "geometry/plane.h"
+# include "geometry/sphere_soa.h"
+
+// a 4x2 block of pixels, one lane each (lane = x + y * PACKET_W)
+# define PACKET_W 4
+# define PACKET_H 2
+# define PACKET_SIZE 8
+
+// rays of a packet laid out per field, like t_sphere_soa.
+// t_max is narrowed to the closest hit of its lane while tracing and best
+// holds that hit (inf until there is one), exactly like t_trace does for
+// a single ray. unused lanes get t_max = best = -inf so every test misses
+// them and they never hold a box open
+typedef struct s_ray_packet
+{
+	float	ox[PACKET_SIZE];
+	float	oy[PACKET_SIZE];
+	float	oz[PACKET_SIZE];
+	float	dx[PACKET_SIZE];
+	float	dy[PACKET_SIZE];
+	float	dz[PACKET_SIZE];
+	float	ix[PACKET_SIZE];
+	float	iy[PACKET_SIZE];
+	float	iz[PACKET_SIZE];
+	float	t_min[PACKET_SIZE];
+	float	t_max[PACKET_SIZE];
+	float	best[PACKET_SIZE];
+}	t_ray_packet;
+
+// lane masks below are bit i for lane i
+void	packet_init(t_ray_packet *p, const t_ray *rays, int active);
+t_ray	packet_ray(const t_ray_packet *p, int lane);
+void	packet_hit(t_ray_packet *p, int lane, float t);
+int		packet_aabb(const t_aabb *box, const t_ray_packet *p, float *t_near);
+int		sphere_packet(const t_sphere_soa *soa, int i, t_ray_packet *p);
+int		plane_packet(const t_plane_math *pl, t_ray_packet *p);
+
+#endif
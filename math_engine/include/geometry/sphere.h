@@ -6,7 +6,7 @@
 /*   By: sabruma <sabruma@student.42firenze.it>     +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2026/03/23 00:57:18 by sabruma           #+#    #+#             */
-/*   Updated: 2026/03/23 00:57:19 by sabruma          ###   ########.fr       */
+/*   Updated: 2026/10/17 22:38:53 by sabruma          ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -15,6 +15,7 @@
 
 # include "core/vec3.h"
 # include "geometry/intersection.h"
+# include "geometry/aabb.h"
 
 typedef struct s_sphere_math
 {
@@ -33,5 +34,9 @@ typedef struct s_sphere_data
 
 int		sphere_init(t_sphere_math *sp, t_sphere_data data);
 bool	sphere_intersect(t_sphere_math *s, t_ray ray, t_hit *hit);
+bool	sphere_intersect_t(const t_sphere_math *s, const t_ray *ray, float *t);
+void	sphere_finalize(const t_sphere_math *s, const t_ray *ray, float t,
+			t_hit *hit);
+t_aabb	sphere_bounds(const t_sphere_math *s);
 
 #endif
\ No newline at end of file
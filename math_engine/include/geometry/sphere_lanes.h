@@ -0,0 +1,97 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   sphere_lanes.h                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: sabruma <sabruma@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 22:40:50 by sabruma           #+#    #+#             */
+/*   Updated: 2026/10/17 22:54:19 by sabruma          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef SPHERE_LANES_H
+# define SPHERE_LANES_H
+
+// internal to the sphere lane kernels: t_vf changes with the target flags,
+// don't include it from headers shared with code built differently.
+// the helpers are static inline on purpose: a 256-bit value crossing an
+// out-of-line call can leave the upper halves dirty for the SSE code
+// of the renderer, which then pays a transition penalty on every op
+
+# include "core/simd.h"
+# include "geometry/sphere_soa.h"
+# include "utils/math_constants.h"
+# include <math.h>
+
+# if SIMD_WIDTH > 1
+
+// one ray broadcast to every lane
+typedef struct s_ray_lanes
+{
+	t_vf	ox;
+	t_vf	oy;
+	t_vf	oz;
+	t_vf	dx;
+	t_vf	dy;
+	t_vf	dz;
+	t_vf	a;
+	t_vf	t_min;
+	t_vf	t_max;
+	t_vf	eps;
+}	t_ray_lanes;
+
+// t_quad of SIMD_WIDTH spheres, miss flags the lanes with delta < 0
+typedef struct s_quad_lanes
+{
+	t_vf	miss;
+	t_vf	b;
+	t_vf	c;
+	t_vf	x0;
+	t_vf	x1;
+}	t_quad_lanes;
+
+// solve_quadratic on every lane: both branches are computed and selected,
+// so each lane gets the very same roots as the scalar code
+static inline void	lanes_solve(t_quad_lanes *q, const t_ray_lanes *r)
+{
+	t_vf	delta;
+	t_vf	small;
+	t_vf	root;
+	t_vf	x0;
+	t_vf	swap;
+
+	delta = vf_sub(vf_mul(q->b, q->b),
+			vf_mul(vf_mul(vf_set1(4.0f), r->a), q->c));
+	q->miss = vf_lt(delta, vf_set1(0.0f));
+	small = vf_le(delta, r->eps);
+	root = vf_sqrt(delta);
+	root = vf_mul(vf_set1(-0.5f), vf_sel(vf_lt(vf_set1(0.0f), q->b),
+				vf_add(q->b, root), vf_sub(q->b, root)));
+	x0 = vf_sel(small, vf_div(vf_mul(vf_set1(-0.5f), q->b), r->a),
+			vf_div(root, r->a));
+	q->x1 = vf_sel(small, x0, vf_div(q->c, root));
+	swap = vf_lt(q->x1, x0);
+	q->x0 = vf_sel(swap, q->x1, x0);
+	q->x1 = vf_sel(swap, x0, q->x1);
+}
+
+// nearest root inside [t_min, t_max] per lane, +inf for misses and NaN roots
+static inline t_vf	lanes_pick(const t_quad_lanes *q, const t_ray_lanes *r)
+{
+	t_vf	out0;
+	t_vf	out1;
+	t_vf	inf;
+	t_vf	t;
+
+	inf = vf_set1(INFINITY);
+	out0 = vf_or(vf_lt(q->x0, r->t_min), vf_lt(r->t_max, q->x0));
+	out1 = vf_or(vf_lt(q->x1, r->t_min), vf_lt(r->t_max, q->x1));
+	t = vf_sel(out0, vf_sel(out1, inf, q->x1), q->x0);
+	t = vf_sel(vf_eq(t, t), t, inf);
+	return (vf_sel(q->miss, inf, t));
+}
+
+# endif
+
+#endif
@@ -0,0 +1,44 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   sphere_soa.h                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: sabruma <sabruma@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 22:40:49 by sabruma           #+#    #+#             */
+/*   Updated: 2026/10/17 23:35:21 by sabruma          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef SPHERE_SOA_H
+# define SPHERE_SOA_H
+
+# include <stddef.h>
+# include "geometry/sphere.h"
+
+// arrays are allocated this many floats past count (NaN filled), so a
+// full batch can be loaded from any sphere index
+# define SPHERE_SOA_PAD 16
+# define SPHERE_SOA_ALIGN 64
+
+// hot data of the spheres, one array per field so a batch of lanes is one
+// load per field. colors are only read when finalizing the winner
+typedef struct s_sphere_soa
+{
+	float	*x;
+	float	*y;
+	float	*z;
+	float	*r2;
+	t_vec3	*color;
+	int		count;
+}	t_sphere_soa;
+
+size_t	sphere_soa_size(int count);
+void	sphere_soa_init(t_sphere_soa *soa, void *mem, const t_sphere_math *sp,
+			int count);
+int		sphere_intersect_n(const t_sphere_soa *soa, const t_ray *ray,
+			const int range[2], float *t);
+void	sphere_soa_finalize(const t_sphere_soa *soa, int i, const t_ray *ray,
+			t_hit *hit);
+
+#endif
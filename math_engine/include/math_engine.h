@@ -6,7 +6,7 @@
 /*   By: sabruma <sabruma@student.42.fr>            +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2026/03/18 18:26:24 by sabruma           #+#    #+#             */
-/*   Updated: 2026/03/31 16:39:57 by sabruma          ###   ########.fr       */
+/*   Updated: 2026/10/18 00:28:25 by sabruma          ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -26,6 +26,7 @@
 # include "utils/common.h"
 # include "utils/debug.h"
 # include "utils/math_constants.h"
+# include "utils/parse_float.h"
 
 # include "geometry/ambient.h"
 # include "geometry/camera.h"
@@ -33,6 +34,12 @@
 # include "geometry/plane.h"
 # include "geometry/cylinder.h"
 # include "geometry/light.h"
+# include "geometry/aabb.h"
+# include "geometry/bvh.h"
+# include "geometry/sphere_soa.h"
+# include "geometry/ray_packet.h"
+
+# include "dispatch/isa.h"
 
 // modify this when supporting new geometry
 typedef struct s_math
@@ -46,6 +53,10 @@ typedef struct s_math
 	int				sp_count;
 	int				pl_count;
 	int				cy_count;
+	t_bvh			bvh;	// spheres and cylinders, planes stay a flat list
+	t_sphere_soa	sp_soa;	// same spheres, SoA for the batch kernel
+	void			*mapping;	// .rtb file the arrays point into, or NULL
+	size_t			mapping_size;
 }	t_math;
 
 // ===== TEST SUITE =====
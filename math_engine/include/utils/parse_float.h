@@ -0,0 +1,78 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   parse_float.h                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: sabruma <sabruma@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:16:36 by sabruma           #+#    #+#             */
+/*   Updated: 2026/10/17 23:16:36 by sabruma          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef PARSE_FLOAT_H
+# define PARSE_FLOAT_H
+
+# include <stdbool.h>
+# include <stddef.h>
+# include <stdint.h>
+
+// decimal text -> float/double, correctly rounded (same bits as strtod).
+// short decimals go through Clinger's fast path, everything else through
+// Eisel-Lemire with a 128 bit table of powers of five. only inputs with
+// more than 19 significant digits that sit on a rounding boundary fall
+// back to the libc (C locale)
+//
+// accepted: [+-]digits[.digits][(e|E)[+-]digits], at least one digit in
+// the mantissa; no blanks, inf, nan or hex. an exponent without digits is
+// not consumed. returns the end of the number, NULL if there is none
+
+# define POW5_MIN_Q -342
+# define POW5_MAX_Q 308
+# define DECIMAL_DIGITS 19
+
+// w * 10^q, w holds the first 19 significant digits
+typedef struct s_decimal
+{
+	uint64_t	w;
+	int64_t		q;
+	int			digits;
+	bool		negative;
+	bool		truncated;
+}	t_decimal;
+
+// IEEE layout and the decimal exponent range where a non zero result
+// is possible; rte is where ties to even can happen exactly
+typedef struct s_binary_format
+{
+	int	mantissa_bits;
+	int	min_exponent;
+	int	infinite_power;
+	int	min_pow10;
+	int	max_pow10;
+	int	min_rte;
+	int	max_rte;
+}	t_binary_format;
+
+// biased exponent and mantissa without the implicit bit
+typedef struct s_adjusted
+{
+	uint64_t	mantissa;
+	int			power2;
+}	t_adjusted;
+
+typedef struct s_u128
+{
+	uint64_t	hi;
+	uint64_t	lo;
+}	t_u128;
+
+// 5^q normalized to the top bit, for q in [POW5_MIN_Q, POW5_MAX_Q]
+extern const uint64_t	g_pow5_128[POW5_MAX_Q - POW5_MIN_Q + 1][2];
+
+const char	*scan_decimal(const char *s, t_decimal *d);
+t_adjusted	eisel_lemire(const t_binary_format *f, int64_t q, uint64_t w);
+const char	*parse_double(const char *s, double *out);
+const char	*parse_float(const char *s, float *out);
+
+#endif
@@ -0,0 +1,13 @@
+# build options shared by the library and miniRT, pass them to make:
+# MATH_INLINE=0 turns the header-inline vec3/mat4 off (every call goes
+# through libmath_engine.a), LTO=1 adds link time optimization.
+# switching either one needs a make re
+MATH_INLINE ?= 1
+LTO ?= 0
+MATH_CFLAGS :=
+ifneq ($(MATH_INLINE),0)
+MATH_CFLAGS += -DMATH_ENGINE_INLINE
+endif
+ifneq ($(LTO),0)
+MATH_CFLAGS += -flto=auto
+endif
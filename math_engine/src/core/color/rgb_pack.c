@@ -0,0 +1,30 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   rgb_pack.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: sabruma <sabruma@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 00:17:58 by sabruma           #+#    #+#             */
+/*   Updated: 2026/10/18 00:28:25 by sabruma          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "core/color.h"
+
+// plain loop on purpose: it is built once per ISA level and each build
+// vectorizes it with the shuffles that level has
+void	rgb_pack_n(const uint32_t *px, uint8_t *out, int n)
+{
+	int	i;
+
+	i = 0;
+	while (i < n)
+	{
+		out[0] = px[i] >> 16;
+		out[1] = px[i] >> 8;
+		out[2] = px[i];
+		out += 3;
+		i++;
+	}
+}
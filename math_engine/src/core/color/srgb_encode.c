@@ -1,43 +1,35 @@
 /* ************************************************************************** */
 /*                                                                            */
 /*                                                        :::      ::::::::   */
-/*   ft_atod.c                                          :+:      :+:    :+:   */
+/*   srgb_encode.c                                      :+:      :+:    :+:   */
 /*                                                    +:+ +:+         +:+     */
 /*   By: gmu <marvin@42.fr>                         +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
-/*   Created: 2026/03/31 22:51:26 by gmu               #+#    #+#             */
-/*   Updated: 2026/03/31 22:55:26 by gmu              ###   ########.fr       */
+/*   Created: 2026/10/17 23:05:15 by gmu               #+#    #+#             */
+/*   Updated: 2026/10/18 00:28:25 by sabruma          ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
-#include "libft.h"
-#include "minirt.h"
+#include "core/color.h"
 
-double	ft_atod(const char *str)
+float	linear_to_srgb_fast(float x)
 {
-	double	s[3];
-	int		sign;
+	float	t;
 
-	s[0] = 0.0;
-	s[1] = 0.0;
-	s[2] = 1.0;
-	sign = 1;
-	while (ft_isspace(*str))
-		str++;
-	if (*str == '+' || *str == '-')
-		if (*str++ == '-')
-			sign = -1;
-	while (ft_isdigit(*str))
-		s[0] = s[0] * 10.0 + (*str++ - '0');
-	if (*str == '.')
-	{
-		str++;
-		while (ft_isdigit(*str))
-		{
-			s[1] = s[1] * 10.0 + (*str++ - '0');
-			s[2] *= 10.0;
-		}
-		s[0] += s[1] / s[2];
-	}
-	return (sign * s[0]);
+	if (!(x > 0.0f))
+		return (0.0f);
+	if (x <= 0.0031308f)
+		return (x * 12.92f);
+	if (x > 1.0f)
+		x = 1.0f;
+	t = sqrtf(sqrtf(x));
+	return (((((SRGB_C5 * t + SRGB_C4) * t + SRGB_C3) * t + SRGB_C2) * t
+			+ SRGB_C1) * t + SRGB_C0);
+}
+
+t_vec3	vec3_linear_to_srgb_fast(t_vec3 linear_color)
+{
+	return ((t_vec3){linear_to_srgb_fast(linear_color.x),
+		linear_to_srgb_fast(linear_color.y),
+		linear_to_srgb_fast(linear_color.z)});
 }
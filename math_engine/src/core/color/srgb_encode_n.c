@@ -0,0 +1,56 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   srgb_encode_n.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: sabruma <sabruma@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 00:17:58 by sabruma           #+#    #+#             */
+/*   Updated: 2026/10/18 00:28:25 by sabruma          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "core/color.h"
+#include "core/simd.h"
+
+#if SIMD_WIDTH > 1
+
+// same polynomial on SIMD_WIDTH values, the toe is blended in by mask.
+// written so NaN ends up as 0 like in the scalar version
+static inline t_vf	srgb_lanes(t_vf x)
+{
+	t_vf	t;
+	t_vf	p;
+
+	x = vf_sel(vf_lt(vf_set1(0.0f), x), x, vf_set1(0.0f));
+	x = vf_sel(vf_lt(vf_set1(1.0f), x), vf_set1(1.0f), x);
+	t = vf_sqrt(vf_sqrt(x));
+	p = vf_add(vf_mul(vf_set1(SRGB_C5), t), vf_set1(SRGB_C4));
+	p = vf_add(vf_mul(p, t), vf_set1(SRGB_C3));
+	p = vf_add(vf_mul(p, t), vf_set1(SRGB_C2));
+	p = vf_add(vf_mul(p, t), vf_set1(SRGB_C1));
+	p = vf_add(vf_mul(p, t), vf_set1(SRGB_C0));
+	return (vf_sel(vf_le(x, vf_set1(0.0031308f)),
+			vf_mul(x, vf_set1(12.92f)), p));
+}
+#endif
+
+// in and out may be the same buffer
+void	linear_to_srgb_n(const float *in, float *out, int n)
+{
+	int	i;
+
+	i = 0;
+#if SIMD_WIDTH > 1
+	while (i + SIMD_WIDTH <= n)
+	{
+		vf_storeu(out + i, srgb_lanes(vf_loadu(in + i)));
+		i += SIMD_WIDTH;
+	}
+#endif
+	while (i < n)
+	{
+		out[i] = linear_to_srgb_fast(in[i]);
+		i++;
+	}
+}
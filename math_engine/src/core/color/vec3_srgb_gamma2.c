@@ -0,0 +1,36 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   vec3_srgb_gamma2.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: gmu <marvin@42.fr>                         +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:05:26 by gmu               #+#    #+#             */
+/*   Updated: 2026/10/17 23:05:26 by gmu              ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "core/color.h"
+
+// above the toe (v > 0.04045) srgb_to_linear, gamma 2 and linear_to_srgb
+// cancel out: 1.055 * (((v + 0.055) / 1.055)^2.4)^(1/2 * 1/2.4) - 0.055
+// is sqrt(1.055 * (v + 0.055)) - 0.055, one sqrt instead of three powf.
+// the toe keeps the long way, it only covers v <= 0.04045
+static float	srgb_gamma2(float v)
+{
+	float	g;
+
+	if (v > 0.04045f)
+		return (sqrtf(1.055f * (v + 0.055f)) - 0.055f);
+	g = sqrtf(v / 12.92f);
+	if (g <= 0.0031308f)
+		return (g * 12.92f);
+	return (1.055f * powf(g, 1.0f / 2.4f) - 0.055f);
+}
+
+// vec3_linear_to_srgb(vec3_gamma_correct(vec3_srgb_to_linear(c), 2.0f))
+t_vec3	vec3_srgb_gamma2(t_vec3 srgb_color)
+{
+	return ((t_vec3){srgb_gamma2(srgb_color.x), srgb_gamma2(srgb_color.y),
+		srgb_gamma2(srgb_color.z)});
+}
@@ -6,22 +6,123 @@
 /*   By: sabruma <sabruma@student.42firenze.it>     +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2026/02/28 01:25:01 by sabruma           #+#    #+#             */
-/*   Updated: 2026/03/18 18:35:32 by sabruma          ###   ########.fr       */
+/*   Updated: 2026/10/18 01:17:32 by sabruma          ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
-#include "core/mat4.h"
+#include "core/mat4_blocks.h"
+#include <math.h>
 
-// Gauss-Jordan method (numerically stable with partial pivoting)
+// |M| = |A||D| + |B||C| - tr(A#B * D#C), in every lane
+static inline t_vec4	full_det(t_vec4 det, t_vec4 ab, t_vec4 dc)
+{
+	t_vec4	t;
+
+	t = vec4_mul(ab, _mm_shuffle_ps(dc, dc, _MM_SHUFFLE(3, 1, 2, 0)));
+	t = vec4_add(t, _mm_shuffle_ps(t, t, _MM_SHUFFLE(2, 3, 0, 1)));
+	t = vec4_add(t, _mm_shuffle_ps(t, t, _MM_SHUFFLE(1, 0, 3, 2)));
+	return (vec4_sub(vec4_add(
+				vec4_mul(_mm_shuffle_ps(det, det, 0x00),
+					_mm_shuffle_ps(det, det, 0xff)),
+				vec4_mul(_mm_shuffle_ps(det, det, 0x55),
+					_mm_shuffle_ps(det, det, 0xaa))), t));
+}
+
+// the blocks of the inverse times |M|, still as their adjugates:
+// q = X# Y# Z# W# with X# = |D|A - B(D#C), Y# = |B|C - D(A#B)#,
+// Z# = |C|B - A(D#C)#, W# = |A|D - C(A#B). returns |M|
+static t_vec4	adjugate(const t_vec4 r[4], t_vec4 q[4])
+{
+	t_vec4	b[4];
+	t_vec4	det;
+	t_vec4	ab;
+	t_vec4	dc;
+
+	b[0] = _mm_movelh_ps(r[0], r[1]);
+	b[1] = _mm_movehl_ps(r[1], r[0]);
+	b[2] = _mm_movelh_ps(r[2], r[3]);
+	b[3] = _mm_movehl_ps(r[3], r[2]);
+	det = mat4_block_dets(r);
+	ab = mat2_adj_mul(b[0], b[1]);
+	dc = mat2_adj_mul(b[3], b[2]);
+	q[0] = vec4_sub(vec4_mul(_mm_shuffle_ps(det, det, 0xff), b[0]),
+			mat2_mul(b[1], dc));
+	q[1] = vec4_sub(vec4_mul(_mm_shuffle_ps(det, det, 0x55), b[2]),
+			mat2_mul_adj(b[3], ab));
+	q[2] = vec4_sub(vec4_mul(_mm_shuffle_ps(det, det, 0xaa), b[1]),
+			mat2_mul_adj(b[0], dc));
+	q[3] = vec4_sub(vec4_mul(_mm_shuffle_ps(det, det, 0x00), b[3]),
+			mat2_mul(b[2], ab));
+	return (full_det(det, ab, dc));
+}
+
+// loads m as D N, D the diagonal of powers of two just under the largest
+// element of each row, so |N| can neither overflow nor vanish for a
+// well-conditioned m whatever its scale. returns 1 / D as a vector
+static t_vec4	load_rows(const t_mat4 *m, t_vec4 r[4])
+{
+	t_vec4	a[4];
+	t_vec4	inv_d;
+	int		i;
+
+	i = -1;
+	while (++i < 4)
+	{
+		r[i] = mat4_row4(m, i);
+		a[i] = _mm_andnot_ps(_mm_set1_ps(-0.0f), r[i]);
+	}
+	_MM_TRANSPOSE4_PS(a[0], a[1], a[2], a[3]);
+	inv_d = _mm_and_ps(vec4_max(vec4_max(a[0], a[1]), vec4_max(a[2], a[3])),
+			_mm_castsi128_ps(_mm_set1_epi32(0x7f800000)));
+	inv_d = _mm_div_ps(_mm_set1_ps(1.0f), inv_d);
+	r[0] = vec4_mul(r[0], _mm_shuffle_ps(inv_d, inv_d, 0x00));
+	r[1] = vec4_mul(r[1], _mm_shuffle_ps(inv_d, inv_d, 0x55));
+	r[2] = vec4_mul(r[2], _mm_shuffle_ps(inv_d, inv_d, 0xaa));
+	r[3] = vec4_mul(r[3], _mm_shuffle_ps(inv_d, inv_d, 0xff));
+	return (inv_d);
+}
+
+// inv(D N) = inv(N) inv(D): column j of inv(N) over d_j
+static t_mat4	unscale(t_mat4 m, t_vec4 inv_d)
+{
+	int	i;
+
+	i = -1;
+	while (++i < 4)
+		_mm_storeu_ps(m.arr + 4 * i, vec4_mul(mat4_row4(&m, i), inv_d));
+	return (m);
+}
+
+// general inverse by 2x2 blocks (cofactors, no pivoting), for any
+// matrix. affine and rigid ones have cheaper mat4_inverse_affine / _rigid.
+// works on N = inv(D) M, see load_rows: |N| < 1e-6 counts as singular.
+// the sign pattern of the 2x2 adjugates goes in with 1 / |N|, which then
+// replaces |N| in det.
 // the identity is just a fallback, NOT the inverse of a singular matrix
 t_mat4	mat4_inverse(t_mat4 m)
 {
-	t_mat4	s;
+	t_vec4	r[4];
+	t_vec4	q[4];
+	t_vec4	det;
+	t_vec4	inv_d;
+	t_mat4	out;
 
-	s = mat4_identity();
-	if (fwd_elimination_inv(&m, &s))
+	inv_d = load_rows(&m, r);
+	det = adjugate(r, q);
+	if (!isfinite(_mm_cvtss_f32(det))
+		|| fabsf(_mm_cvtss_f32(det)) < 1e-6f)
 		return (mat4_identity());
-	reduce_diagonal_inv(&m, &s);
-	eliminate_above_inv(&m, &s);
-	return (s);
+	det = _mm_div_ps(_mm_setr_ps(1.0f, -1.0f, -1.0f, 1.0f), det);
+	q[0] = vec4_mul(q[0], det);
+	q[1] = vec4_mul(q[1], det);
+	q[2] = vec4_mul(q[2], det);
+	q[3] = vec4_mul(q[3], det);
+	_mm_storeu_ps(out.arr, _mm_shuffle_ps(q[0], q[1], _MM_SHUFFLE(1, 3, 1, 3)));
+	_mm_storeu_ps(out.arr + 4, _mm_shuffle_ps(q[0], q[1],
+			_MM_SHUFFLE(0, 2, 0, 2)));
+	_mm_storeu_ps(out.arr + 8, _mm_shuffle_ps(q[2], q[3],
+			_MM_SHUFFLE(1, 3, 1, 3)));
+	_mm_storeu_ps(out.arr + 12, _mm_shuffle_ps(q[2], q[3],
+			_MM_SHUFFLE(0, 2, 0, 2)));
+	return (unscale(out, inv_d));
 }
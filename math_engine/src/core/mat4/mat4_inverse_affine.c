@@ -0,0 +1,73 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   mat4_inverse_affine.c                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: sabruma <sabruma@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 00:36:02 by sabruma           #+#    #+#             */
+/*   Updated: 2026/10/18 00:37:48 by sabruma          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "core/vec4.h"
+#include <math.h>
+
+// k[0..2] are the columns of the inverse 3x3 part: transposed they are
+// its rows. the translation of m times that inverse, negated, is the
+// new translation. the w lanes of k end up in k[3] and are dropped
+static t_mat4	from_columns(t_vec4 k[4], const t_mat4 *m)
+{
+	t_mat4	out;
+	t_vec4	t;
+
+	k[3] = _mm_setzero_ps();
+	_MM_TRANSPOSE4_PS(k[0], k[1], k[2], k[3]);
+	t = vec4_add(vec4_add(vec4_mul(vec4_splat(m->m30), k[0]),
+				vec4_mul(vec4_splat(m->m31), k[1])),
+			vec4_mul(vec4_splat(m->m32), k[2]));
+	_mm_storeu_ps(out.arr, k[0]);
+	_mm_storeu_ps(out.arr + 4, k[1]);
+	_mm_storeu_ps(out.arr + 8, k[2]);
+	_mm_storeu_ps(out.arr + 12, vec4_sub(_mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f),
+			t));
+	return (out);
+}
+
+// m must be affine (mat4_is_affine): the last column isn't read.
+// with rows a b c the inverse of the 3x3 part has b x c, c x a and
+// a x b as columns, over a . (b x c).
+// the identity is just a fallback, NOT the inverse of a singular matrix
+t_mat4	mat4_inverse_affine(t_mat4 m)
+{
+	t_vec4	r[3];
+	t_vec4	k[4];
+	float	inv_det;
+
+	r[0] = mat4_row4(&m, 0);
+	r[1] = mat4_row4(&m, 1);
+	r[2] = mat4_row4(&m, 2);
+	k[0] = vec4_cross(r[1], r[2]);
+	k[1] = vec4_cross(r[2], r[0]);
+	k[2] = vec4_cross(r[0], r[1]);
+	inv_det = 1.0f / vec4_dot(r[0], k[0]);
+	if (!isfinite(inv_det))
+		return (mat4_identity());
+	k[0] = vec4_scale(k[0], inv_det);
+	k[1] = vec4_scale(k[1], inv_det);
+	k[2] = vec4_scale(k[2], inv_det);
+	return (from_columns(k, &m));
+}
+
+// m must be a rotation plus a translation (orthonormal 3x3 part, like
+// mat4_look_at with a unit forward): the rotation is just transposed,
+// nothing is checked
+t_mat4	mat4_inverse_rigid(t_mat4 m)
+{
+	t_vec4	k[4];
+
+	k[0] = mat4_row4(&m, 0);
+	k[1] = mat4_row4(&m, 1);
+	k[2] = mat4_row4(&m, 2);
+	return (from_columns(k, &m));
+}
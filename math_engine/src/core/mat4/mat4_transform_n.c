@@ -0,0 +1,78 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   mat4_transform_n.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: sabruma <sabruma@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 00:29:45 by sabruma           #+#    #+#             */
+/*   Updated: 2026/10/18 00:31:39 by sabruma          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "core/vec4.h"
+
+// one point or vector per register: x y z splatted against the rows,
+// summed in the order of mat4_transform_vector
+static inline t_vec4	linear(const t_vec4 r[4], t_vec4 v)
+{
+	t_vec4	s;
+
+	s = vec4_mul(_mm_shuffle_ps(v, v, 0x00), r[0]);
+	s = vec4_add(s, vec4_mul(_mm_shuffle_ps(v, v, 0x55), r[1]));
+	return (vec4_add(s, vec4_mul(_mm_shuffle_ps(v, v, 0xaa), r[2])));
+}
+
+// the rows are loaded once: out may alias m as far as the compiler
+// knows, so reading them through m would reload them every point
+static void	load_rows(const t_mat4 *m, t_vec4 r[4])
+{
+	r[0] = mat4_row4(m, 0);
+	r[1] = mat4_row4(m, 1);
+	r[2] = mat4_row4(m, 2);
+	r[3] = mat4_row4(m, 3);
+}
+
+// lane 3 of a transformed point is its w, the projective row
+static void	points_projective(const t_vec4 r[4], const t_vec3 *in,
+				t_vec3 *out, int n)
+{
+	t_vec4	p;
+	int		i;
+
+	i = -1;
+	while (++i < n)
+	{
+		p = vec4_add(linear(r, vec4_load3(in + i)), r[3]);
+		vec4_store3(out + i, _mm_div_ps(p, _mm_shuffle_ps(p, p, 0xff)));
+	}
+}
+
+void	mat4_transform_points(const t_mat4 *m, const t_vec3 *in, t_vec3 *out,
+			int n)
+{
+	t_vec4	r[4];
+	int		i;
+
+	load_rows(m, r);
+	if (!mat4_is_affine(*m, 0.0f))
+	{
+		points_projective(r, in, out, n);
+		return ;
+	}
+	i = -1;
+	while (++i < n)
+		vec4_store3(out + i, vec4_add(linear(r, vec4_load3(in + i)), r[3]));
+}
+
+void	mat4_transform_vectors(const t_mat4 *m, const t_vec3 *in, t_vec3 *out,
+			int n)
+{
+	t_vec4	r[4];
+	int		i;
+
+	load_rows(m, r);
+	i = -1;
+	while (++i < n)
+		vec4_store3(out + i, linear(r, vec4_load3(in + i)));
+}
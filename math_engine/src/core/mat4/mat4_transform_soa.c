@@ -0,0 +1,114 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   mat4_transform_soa.c                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: sabruma <sabruma@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 00:30:03 by sabruma           #+#    #+#             */
+/*   Updated: 2026/10/18 00:31:39 by sabruma          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "core/mat4.h"
+#include "core/simd.h"
+
+// what is done to each x y z: 0 vector, 1 affine point, 2 projective point
+#define SOA_VECTOR 0
+#define SOA_POINT 1
+#define SOA_PROJECTIVE 2
+
+#if SIMD_WIDTH > 1
+
+// SIMD_WIDTH points at once, c is m with every element splatted.
+// same sums as mat4_transform_point, then the divide by w
+static inline void	lanes_apply(const t_vf c[16], t_vf v[3], int kind)
+{
+	t_vf	r[4];
+	int		j;
+
+	j = -1;
+	while (++j < 3 + (kind == SOA_PROJECTIVE))
+	{
+		r[j] = vf_add(vf_add(vf_mul(v[0], c[j]), vf_mul(v[1], c[4 + j])),
+				vf_mul(v[2], c[8 + j]));
+		if (kind != SOA_VECTOR)
+			r[j] = vf_add(r[j], c[12 + j]);
+	}
+	j = -1;
+	while (++j < 3)
+	{
+		v[j] = r[j];
+		if (kind == SOA_PROJECTIVE)
+			v[j] = vf_div(r[j], r[3]);
+	}
+}
+
+// the full batches, returns how many points they covered
+static inline int	soa_lanes(const t_mat4 *m, const t_vec3_soa *v[2], int n,
+						int kind)
+{
+	t_vf	c[16];
+	t_vf	p[3];
+	int		i;
+
+	i = -1;
+	while (++i < 16)
+		c[i] = vf_set1(m->arr[i]);
+	i = 0;
+	while (i + SIMD_WIDTH <= n)
+	{
+		p[0] = vf_loadu(v[0]->x + i);
+		p[1] = vf_loadu(v[0]->y + i);
+		p[2] = vf_loadu(v[0]->z + i);
+		lanes_apply(c, p, kind);
+		vf_storeu(v[1]->x + i, p[0]);
+		vf_storeu(v[1]->y + i, p[1]);
+		vf_storeu(v[1]->z + i, p[2]);
+		i += SIMD_WIDTH;
+	}
+	return (i);
+}
+#endif
+
+// v[0] in, v[1] out. the points past the last full batch one by one
+static inline void	soa_run(const t_mat4 *m, const t_vec3_soa *v[2], int n,
+						int kind)
+{
+	t_vec3	p;
+	float	w;
+	int		i;
+
+	i = 0;
+#if SIMD_WIDTH > 1
+	i = soa_lanes(m, v, n, kind);
+#endif
+	while (i < n)
+	{
+		p = (t_vec3){v[0]->x[i], v[0]->y[i], v[0]->z[i]};
+		w = 1.0f;
+		if (kind == SOA_PROJECTIVE)
+			w = p.x * m->m03 + p.y * m->m13 + p.z * m->m23 + m->m33;
+		if (kind == SOA_VECTOR)
+			p = mat4_transform_vector(*m, p);
+		else
+			p = mat4_transform_point(*m, p);
+		v[1]->x[i] = p.x / w;
+		v[1]->y[i] = p.y / w;
+		v[1]->z[i] = p.z / w;
+		i++;
+	}
+}
+
+void	mat4_transform_points_soa(const t_mat4 *m, const t_vec3_soa *in,
+			const t_vec3_soa *out, int n)
+{
+	soa_run(m, (const t_vec3_soa *[2]){in, out}, n,
+		SOA_POINT + !mat4_is_affine(*m, 0.0f));
+}
+
+void	mat4_transform_vectors_soa(const t_mat4 *m, const t_vec3_soa *in,
+			const t_vec3_soa *out, int n)
+{
+	soa_run(m, (const t_vec3_soa *[2]){in, out}, n, SOA_VECTOR);
+}
@@ -0,0 +1,23 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   dispatch_color.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: sabruma <sabruma@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 00:19:33 by sabruma           #+#    #+#             */
+/*   Updated: 2026/10/18 00:28:25 by sabruma          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "dispatch/isa_kernels.h"
+
+void	linear_to_srgb_n(const float *in, float *out, int n)
+{
+	isa_kernels()->srgb_n(in, out, n);
+}
+
+void	rgb_pack_n(const uint32_t *px, uint8_t *out, int n)
+{
+	isa_kernels()->rgb_pack(px, out, n);
+}
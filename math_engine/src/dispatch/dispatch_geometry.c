@@ -0,0 +1,34 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   dispatch_geometry.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: sabruma <sabruma@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 00:19:33 by sabruma           #+#    #+#             */
+/*   Updated: 2026/10/18 00:28:25 by sabruma          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "dispatch/isa_kernels.h"
+
+int	sphere_intersect_n(const t_sphere_soa *soa, const t_ray *ray,
+		const int range[2], float *t)
+{
+	return (isa_kernels()->sphere_n(soa, ray, range, t));
+}
+
+int	sphere_packet(const t_sphere_soa *soa, int i, t_ray_packet *p)
+{
+	return (isa_kernels()->sphere_packet(soa, i, p));
+}
+
+int	plane_packet(const t_plane_math *pl, t_ray_packet *p)
+{
+	return (isa_kernels()->plane_packet(pl, p));
+}
+
+int	packet_aabb(const t_aabb *box, const t_ray_packet *p, float *t_near)
+{
+	return (isa_kernels()->packet_aabb(box, p, t_near));
+}
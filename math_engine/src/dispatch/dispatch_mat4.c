@@ -0,0 +1,25 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   dispatch_mat4.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: sabruma <sabruma@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 00:30:16 by sabruma           #+#    #+#             */
+/*   Updated: 2026/10/18 00:31:39 by sabruma          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "dispatch/isa_kernels.h"
+
+void	mat4_transform_points_soa(const t_mat4 *m, const t_vec3_soa *in,
+			const t_vec3_soa *out, int n)
+{
+	isa_kernels()->points_soa(m, in, out, n);
+}
+
+void	mat4_transform_vectors_soa(const t_mat4 *m, const t_vec3_soa *in,
+			const t_vec3_soa *out, int n)
+{
+	isa_kernels()->vectors_soa(m, in, out, n);
+}
@@ -0,0 +1,58 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   isa.c                                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: sabruma <sabruma@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 00:19:27 by sabruma           #+#    #+#             */
+/*   Updated: 2026/10/18 00:31:39 by sabruma          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "dispatch/isa_kernels.h"
+
+static const t_isa_kernels	g_kernels[3] = {
+{sphere_intersect_n_sse2, sphere_packet_sse2, plane_packet_sse2,
+	packet_aabb_sse2, linear_to_srgb_n_sse2, rgb_pack_n_sse2,
+	mat4_transform_points_soa_sse2, mat4_transform_vectors_soa_sse2},
+{sphere_intersect_n_avx2, sphere_packet_avx2, plane_packet_avx2,
+	packet_aabb_avx2, linear_to_srgb_n_avx2, rgb_pack_n_avx2,
+	mat4_transform_points_soa_avx2, mat4_transform_vectors_soa_avx2},
+{sphere_intersect_n_avx512, sphere_packet_avx512, plane_packet_avx512,
+	packet_aabb_avx512, linear_to_srgb_n_avx512, rgb_pack_n_avx512,
+	mat4_transform_points_soa_avx512, mat4_transform_vectors_soa_avx512}
+};
+
+// selected level, SSE2 until isa_select runs: it is there on every x86-64
+static t_isa	*isa_state(void)
+{
+	static t_isa	isa = ISA_SSE2;
+
+	return (&isa);
+}
+
+const t_isa_kernels	*isa_kernels(void)
+{
+	return (&g_kernels[*isa_state() - ISA_SSE2]);
+}
+
+// once at startup, before any thread renders. 1 if this cpu can't run
+// the requested level, the previous one stays then
+int	isa_select(t_isa isa)
+{
+	t_isa	best;
+
+	best = isa_detect();
+	if (isa == ISA_AUTO)
+		isa = best;
+	if (isa > best)
+		return (1);
+	*isa_state() = isa;
+	return (0);
+}
+
+t_isa	isa_current(void)
+{
+	return (*isa_state());
+}
@@ -0,0 +1,41 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   isa_detect.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: sabruma <sabruma@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 00:19:26 by sabruma           #+#    #+#             */
+/*   Updated: 2026/10/18 00:28:25 by sabruma          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "dispatch/isa.h"
+
+// libgcc reads cpuid and also checks with xgetbv that the kernel saves
+// the ymm / zmm registers, so a level reported here is usable
+static bool	has_avx2(void)
+{
+	return (__builtin_cpu_supports("avx2")
+		&& __builtin_cpu_supports("fma"));
+}
+
+static bool	has_avx512(void)
+{
+	return (has_avx2()
+		&& __builtin_cpu_supports("avx512f")
+		&& __builtin_cpu_supports("avx512vl")
+		&& __builtin_cpu_supports("avx512bw")
+		&& __builtin_cpu_supports("avx512dq"));
+}
+
+// best level of this cpu, SSE2 is part of x86-64
+t_isa	isa_detect(void)
+{
+	__builtin_cpu_init();
+	if (has_avx512())
+		return (ISA_AVX512);
+	if (has_avx2())
+		return (ISA_AVX2);
+	return (ISA_SSE2);
+}
@@ -0,0 +1,35 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   isa_name.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: sabruma <sabruma@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 00:19:33 by sabruma           #+#    #+#             */
+/*   Updated: 2026/10/18 00:28:25 by sabruma          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "dispatch/isa.h"
+#include <string.h>
+
+static const char	*g_names[4] = {"auto", "sse2", "avx2", "avx512"};
+
+const char	*isa_name(t_isa isa)
+{
+	return (g_names[isa]);
+}
+
+bool	isa_parse(const char *s, t_isa *isa)
+{
+	t_isa	i;
+
+	i = ISA_AUTO;
+	while (i <= ISA_AVX512)
+	{
+		if (!strcmp(s, g_names[i]))
+			return (*isa = i, true);
+		i++;
+	}
+	return (false);
+}
@@ -0,0 +1,49 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   aabb.c                                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: sabruma <sabruma@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 22:26:50 by sabruma           #+#    #+#             */
+/*   Updated: 2026/10/17 22:26:50 by sabruma          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "geometry/aabb.h"
+#include <math.h>
+
+t_aabb	aabb_empty(void)
+{
+	return ((t_aabb){
+		.min = {INFINITY, INFINITY, INFINITY},
+		.max = {-INFINITY, -INFINITY, -INFINITY}
+	});
+}
+
+t_aabb	aabb_union(t_aabb a, t_aabb b)
+{
+	return ((t_aabb){
+		.min = vec3_min_comp(a.min, b.min),
+		.max = vec3_max_comp(a.max, b.max)
+	});
+}
+
+t_aabb	aabb_grow(t_aabb box, t_vec3 p)
+{
+	return ((t_aabb){
+		.min = vec3_min_comp(box.min, p),
+		.max = vec3_max_comp(box.max, p)
+	});
+}
+
+// surface area, 0 for an empty box
+float	aabb_area(t_aabb box)
+{
+	t_vec3	d;
+
+	d = vec3_sub(box.max, box.min);
+	if (d.x < 0.0f || d.y < 0.0f || d.z < 0.0f)
+		return (0.0f);
+	return (2.0f * (d.x * d.y + d.y * d.z + d.z * d.x));
+}
@@ -0,0 +1,93 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   aabb_intersect.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: sabruma <sabruma@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 22:27:00 by sabruma           #+#    #+#             */
+/*   Updated: 2026/10/18 01:19:49 by sabruma          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "geometry/aabb.h"
+
+#ifdef __SSE2__
+# include "core/vec4.h"
+
+// entry (t[0]) and exit (t[1]) of the three pairs of slabs, lane by lane.
+// a NaN lane (origin on the slab with a parallel ray) isn't swapped
+static void	slabs(const t_aabb *box, const t_ray *ray, t_vec4 inv,
+				t_vec4 t[2])
+{
+	t_vec4	origin;
+	t_vec4	t0;
+	t_vec4	t1;
+	t_vec4	swap;
+
+	origin = vec4_load3(&ray->origin);
+	t0 = vec4_mul(vec4_sub(vec4_load3(&box->min), origin), inv);
+	t1 = vec4_mul(vec4_sub(vec4_load3(&box->max), origin), inv);
+	swap = _mm_cmpgt_ps(t0, t1);
+	t[0] = vec4_select(swap, t1, t0);
+	t[1] = vec4_select(swap, t0, t1);
+}
+
+// slab test clipped to [t_min, t_max], inv_dir holds 1 / ray->direction
+// t_near is the entry distance, used to visit boxes front to back.
+// the clip comes before the horizontal min/max: vec4_max and vec4_min
+// return the ray bound for NaN lanes, so they leave the span untouched
+bool	aabb_intersect(const t_aabb *box, const t_ray *ray, t_vec3 inv_dir,
+			float *t_near)
+{
+	t_vec4	t[2];
+	float	near;
+	float	far;
+
+	slabs(box, ray, vec4_from_vec3(inv_dir, 0.0f), t);
+	near = vec4_hmax3(vec4_max(t[0], vec4_splat(ray->t_min)));
+	far = vec4_hmin3(vec4_min(t[1], vec4_splat(ray->t_max)));
+	*t_near = near;
+	return (near <= far);
+}
+
+#else
+# include "utils/common.h"
+
+// narrows span to the part of the ray inside one pair of slabs,
+// a NaN (origin on the slab with a parallel ray) leaves span untouched
+static void	slab(float min, float max, float inv, float span[2])
+{
+	float	t0;
+	float	t1;
+
+	t0 = min * inv;
+	t1 = max * inv;
+	if (t0 > t1)
+		swapf(&t0, &t1);
+	if (t0 > span[0])
+		span[0] = t0;
+	if (t1 < span[1])
+		span[1] = t1;
+}
+
+// slab test clipped to [t_min, t_max], inv_dir holds 1 / ray->direction
+// t_near is the entry distance, used to visit boxes front to back
+bool	aabb_intersect(const t_aabb *box, const t_ray *ray, t_vec3 inv_dir,
+			float *t_near)
+{
+	float	span[2];
+
+	span[0] = ray->t_min;
+	span[1] = ray->t_max;
+	slab(box->min.x - ray->origin.x, box->max.x - ray->origin.x,
+		inv_dir.x, span);
+	slab(box->min.y - ray->origin.y, box->max.y - ray->origin.y,
+		inv_dir.y, span);
+	slab(box->min.z - ray->origin.z, box->max.z - ray->origin.z,
+		inv_dir.z, span);
+	*t_near = span[0];
+	return (span[0] <= span[1]);
+}
+
+#endif
@@ -0,0 +1,89 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bvh_build.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: sabruma <sabruma@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 22:27:23 by sabruma           #+#    #+#             */
+/*   Updated: 2026/10/17 23:35:21 by sabruma          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "geometry/bvh.h"
+
+static void	node_bounds(const t_bvh_prim *prims, int count, t_aabb *box,
+				t_aabb *cbox)
+{
+	*box = aabb_empty();
+	*cbox = aabb_empty();
+	while (count-- > 0)
+	{
+		*box = aabb_union(*box, prims->box);
+		*cbox = aabb_grow(*cbox, prims->centroid);
+		prims++;
+	}
+}
+
+// small nodes stay leaves when no split beats intersecting them all,
+// one traversal step costs about as much as one primitive test.
+// coincident centroids can't be binned: big nodes get cut in half
+static void	build_node(t_bvh_builder *b, int idx, int depth)
+{
+	t_bvh_node	*node;
+	t_bvh_split	split;
+	t_aabb		cbox;
+	int			mid;
+
+	node = &b->bvh->nodes[idx];
+	node_bounds(b->prims + node->first, node->count, &node->box, &cbox);
+	if (node->count <= 1 || depth >= BVH_MAX_DEPTH)
+		return ;
+	mid = node->count / 2;
+	if (bvh_find_split(b->prims + node->first, node->count, cbox, &split)
+		&& (node->count > BVH_LEAF_SIZE || split.cost
+			+ aabb_area(node->box) < node->count * aabb_area(node->box)))
+		mid = bvh_partition(b->prims + node->first, node->count, &split);
+	else if (node->count <= BVH_LEAF_SIZE)
+		return ;
+	b->bvh->nodes[b->bvh->node_count] = (t_bvh_node){
+		.first = node->first, .count = mid};
+	b->bvh->nodes[b->bvh->node_count + 1] = (t_bvh_node){
+		.first = node->first + mid, .count = node->count - mid};
+	node->first = b->bvh->node_count;
+	node->count = 0;
+	b->bvh->node_count += 2;
+	build_node(b, node->first, depth + 1);
+	build_node(b, node->first + 1, depth + 1);
+}
+
+t_bvh_prim	bvh_prim(t_aabb box, t_bvh_ref ref)
+{
+	return ((t_bvh_prim){
+		.box = box,
+		.centroid = vec3_scale(vec3_add(box.min, box.max), 0.5f),
+		.ref = ref
+	});
+}
+
+// binned SAH build over count primitives, prims is reordered in leaf order.
+// bvh->nodes and bvh->refs are caller memory, room for 2 * count - 1 nodes
+// and count refs. an empty scene gives an empty tree: node_count == 0
+void	bvh_build(t_bvh *bvh, t_bvh_prim *prims, int count)
+{
+	t_bvh_builder	b;
+	int				i;
+
+	bvh->node_count = 0;
+	bvh->ref_count = 0;
+	if (count <= 0)
+		return ;
+	b = (t_bvh_builder){.bvh = bvh, .prims = prims};
+	bvh->nodes[0] = (t_bvh_node){.first = 0, .count = count};
+	bvh->node_count = 1;
+	build_node(&b, 0, 0);
+	i = -1;
+	while (++i < count)
+		bvh->refs[i] = prims[i].ref;
+	bvh->ref_count = count;
+}
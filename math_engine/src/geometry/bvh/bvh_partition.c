@@ -0,0 +1,58 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bvh_partition.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: sabruma <sabruma@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 22:27:23 by sabruma           #+#    #+#             */
+/*   Updated: 2026/10/17 22:27:23 by sabruma          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "geometry/bvh.h"
+
+float	bvh_axis(t_vec3 v, int axis)
+{
+	if (axis == 0)
+		return (v.x);
+	if (axis == 1)
+		return (v.y);
+	return (v.z);
+}
+
+int	bvh_bin(const t_bvh_split *split, t_vec3 centroid)
+{
+	int	bin;
+
+	bin = (int)((bvh_axis(centroid, split->axis) - split->min) * split->scale);
+	if (bin < 0)
+		return (0);
+	if (bin >= BVH_BINS)
+		return (BVH_BINS - 1);
+	return (bin);
+}
+
+// moves the primitives binned before split->bin to the front,
+// returns how many they are
+int	bvh_partition(t_bvh_prim *prims, int count, const t_bvh_split *split)
+{
+	t_bvh_prim	tmp;
+	int			i;
+	int			j;
+
+	i = 0;
+	j = count - 1;
+	while (i <= j)
+	{
+		if (bvh_bin(split, prims[i].centroid) < split->bin)
+			i++;
+		else
+		{
+			tmp = prims[i];
+			prims[i] = prims[j];
+			prims[j--] = tmp;
+		}
+	}
+	return (i);
+}
@@ -0,0 +1,106 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bvh_sah.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: sabruma <sabruma@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 22:27:23 by sabruma           #+#    #+#             */
+/*   Updated: 2026/10/17 22:27:23 by sabruma          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "geometry/bvh.h"
+#include <math.h>
+
+static void	fill_bins(const t_bvh_prim *prims, int count,
+				const t_bvh_split *split, t_bvh_bin *bins)
+{
+	int	i;
+
+	i = 0;
+	while (i < BVH_BINS)
+		bins[i++] = (t_bvh_bin){.box = aabb_empty(), .count = 0};
+	while (count-- > 0)
+	{
+		i = bvh_bin(split, prims->centroid);
+		bins[i].box = aabb_union(bins[i].box, prims->box);
+		bins[i].count++;
+		prims++;
+	}
+}
+
+// right[i]: area * count of the bins from i to the end,
+// infinite when they are all empty so the cut is never chosen
+static void	sweep_right(const t_bvh_bin *bins, float *right)
+{
+	t_aabb	box;
+	int		n;
+	int		i;
+
+	box = aabb_empty();
+	n = 0;
+	i = BVH_BINS;
+	while (--i > 0)
+	{
+		box = aabb_union(box, bins[i].box);
+		n += bins[i].count;
+		right[i] = INFINITY;
+		if (n)
+			right[i] = aabb_area(box) * n;
+	}
+}
+
+// SAH cost of cutting before bin i, keeps the cheapest cut in split
+static void	sweep(const t_bvh_bin *bins, t_bvh_split *split)
+{
+	float	right[BVH_BINS];
+	t_aabb	box;
+	float	cost;
+	int		n;
+	int		i;
+
+	sweep_right(bins, right);
+	box = aabb_empty();
+	n = 0;
+	i = 0;
+	while (++i < BVH_BINS)
+	{
+		box = aabb_union(box, bins[i - 1].box);
+		n += bins[i - 1].count;
+		cost = right[i] + aabb_area(box) * n;
+		if (n && cost < split->cost)
+		{
+			split->cost = cost;
+			split->bin = i;
+		}
+	}
+}
+
+// tries BVH_BINS - 1 cuts on every axis the centroids spread over,
+// false when they all coincide (or the only cuts leave a side empty)
+bool	bvh_find_split(const t_bvh_prim *prims, int count, t_aabb cbox,
+			t_bvh_split *best)
+{
+	t_bvh_bin	bins[BVH_BINS];
+	t_bvh_split	cand;
+	float		extent;
+
+	best->cost = INFINITY;
+	cand.axis = -1;
+	while (++cand.axis < 3)
+	{
+		cand.min = bvh_axis(cbox.min, cand.axis);
+		extent = bvh_axis(cbox.max, cand.axis) - cand.min;
+		if (extent > 0.0f)
+		{
+			cand.scale = BVH_BINS / extent;
+			cand.cost = best->cost;
+			fill_bins(prims, count, &cand, bins);
+			sweep(bins, &cand);
+			if (cand.cost < best->cost)
+				*best = cand;
+		}
+	}
+	return (best->cost < INFINITY);
+}
@@ -6,7 +6,7 @@
 /*   By: sabruma <sabruma@student.42.fr>            +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2026/03/14 01:52:03 by sabruma           #+#    #+#             */
-/*   Updated: 2026/03/30 21:39:07 by sabruma          ###   ########.fr       */
+/*   Updated: 2026/10/18 00:37:48 by sabruma          ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -17,25 +17,59 @@
 
 #include "utils/debug.h"
 
+// the image plane at distance 1 in world space, the same plane
+// camera_raygen used to reach through cam_to_world for every pixel:
+// x spans [-zoom * aspect, zoom * aspect] and y [zoom, -zoom]
+static void	camera_plane(t_camera_math *cam)
+{
+	t_vec3	right;
+	t_vec3	up;
+	t_vec3	forward;
+	float	half_w;
+
+	right = vec3_new(cam->cam_to_world.m00, cam->cam_to_world.m01,
+			cam->cam_to_world.m02);
+	up = vec3_new(cam->cam_to_world.m10, cam->cam_to_world.m11,
+			cam->cam_to_world.m12);
+	forward = vec3_new(cam->cam_to_world.m20, cam->cam_to_world.m21,
+			cam->cam_to_world.m22);
+	half_w = cam->zoom * cam->image_aspect;
+	cam->du = vec3_scale(right, 2.0f * half_w / cam->image_w);
+	cam->dv = vec3_scale(up, -2.0f * cam->zoom / cam->image_h);
+	cam->plane_origin = vec3_add(forward, vec3_add(vec3_scale(right, -half_w),
+				vec3_scale(up, cam->zoom)));
+}
+
+// the frame size only changes the pixel steps and the canvas,
+// so a loaded camera can be pointed at any resolution
+void	camera_resize(t_camera_math *cam, int width, int height)
+{
+	cam->image_h = height;
+	cam->image_w = width;
+	cam->image_aspect = (float)cam->image_w / cam->image_h;
+	cam->canvas[1] = cam->zoom * cam->near_clip;
+	cam->canvas[0] = -cam->canvas[1];
+	cam->canvas[3] = (cam->canvas[1] / cam->image_aspect);
+	cam->canvas[2] = -cam->canvas[3];
+	camera_plane(cam);
+}
+
 // camera initialization
 // conventions: hfov is horizontal fov per subject (in degrees)
 // canvas is symmetrical across the center (0, 0)
 // top = ((r - l)/aspect)/2 = 2r/aspect/2 = r/aspect
+// the inverse is the affine one, not the rigid one: the forward row
+// keeps the length the scene gave it
 int	camera_init(t_camera_math *cam, t_camera_data data)
 {
 	if (!cam)
 		return (1);
 	cam->cam_to_world = mat4_look_at_fast(data.eye, data.orientation);
+	cam->world_to_cam = mat4_inverse_affine(cam->cam_to_world);
 	cam->near_clip = data.near;
 	cam->far_clip = data.far;
-	cam->image_h = data.image_h;
-	cam->image_w = data.image_w;
 	cam->hfov = data.hfov;
-	cam->image_aspect = (float)cam->image_w / cam->image_h;
 	cam->zoom = tanf(deg_to_rad(cam->hfov * 0.5));
-	cam->canvas[1] = cam->zoom * cam->near_clip;
-	cam->canvas[0] = -cam->canvas[1];
-	cam->canvas[3] = (cam->canvas[1] / cam->image_aspect);
-	cam->canvas[2] = -cam->canvas[3];
+	camera_resize(cam, data.image_w, data.image_h);
 	return (0);
 }
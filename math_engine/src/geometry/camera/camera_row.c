@@ -0,0 +1,70 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   camera_row.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: sabruma <sabruma@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 22:55:05 by sabruma           #+#    #+#             */
+/*   Updated: 2026/10/17 22:55:05 by sabruma          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "geometry/camera.h"
+#include <math.h>
+
+// vec3_normalize on every direction of the row
+static void	row_normalize(t_ray_row *row)
+{
+	float	inv;
+	int		i;
+
+	i = 0;
+	while (i < row->count)
+	{
+		inv = 1.0f / sqrtf(row->dx[i] * row->dx[i] + row->dy[i] * row->dy[i]
+				+ row->dz[i] * row->dz[i]);
+		row->dx[i] *= inv;
+		row->dy[i] *= inv;
+		row->dz[i] *= inv;
+		i++;
+	}
+}
+
+// primary rays of count pixels (at most CAMERA_ROW) from start rightwards.
+// the row start on the plane is computed once, then each pixel is one
+// du step multiple away: no running sum, so a pixel gets the same ray
+// as from camera_raygen whatever the row it was generated in
+void	camera_row(const t_camera_math *cam, t_pixel start, int count,
+			t_ray_row *row)
+{
+	t_vec3	base;
+	float	u;
+	int		i;
+
+	if (count > CAMERA_ROW)
+		count = CAMERA_ROW;
+	base = vec3_add(cam->plane_origin, vec3_scale(cam->dv, start.y + 0.5f));
+	i = -1;
+	while (++i < count)
+	{
+		u = start.x + i + 0.5f;
+		row->dx[i] = base.x + cam->du.x * u;
+		row->dy[i] = base.y + cam->du.y * u;
+		row->dz[i] = base.z + cam->du.z * u;
+	}
+	row->origin = camera_eye(cam);
+	row->t_min = cam->near_clip;
+	row->t_max = cam->far_clip;
+	row->count = count;
+	row_normalize(row);
+}
+
+t_ray	camera_row_ray(const t_ray_row *row, int i)
+{
+	return ((t_ray){
+		.origin = row->origin,
+		.direction = {row->dx[i], row->dy[i], row->dz[i]},
+		.t_max = row->t_max,
+		.t_min = row->t_min});
+}
@@ -0,0 +1,46 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   cylinder_bounds.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: sabruma <sabruma@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 22:27:00 by sabruma           #+#    #+#             */
+/*   Updated: 2026/10/17 22:27:00 by sabruma          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "geometry/cylinder.h"
+#include <math.h>
+
+// extent of a disk of radius r with normal a on each world axis
+static t_vec3	disk_extent(t_vec3 a, float r)
+{
+	return ((t_vec3){
+		.x = r * sqrtf(fmaxf(0.0f, 1.0f - a.x * a.x)),
+		.y = r * sqrtf(fmaxf(0.0f, 1.0f - a.y * a.y)),
+		.z = r * sqrtf(fmaxf(0.0f, 1.0f - a.z * a.z))
+	});
+}
+
+// the side test accepts points up to height / |axis| along the axis while
+// the caps sit at height * |axis|: the box spans the farthest of the two
+// so a not perfectly normalized axis from the scene stays inside
+t_aabb	cylinder_bounds(const t_cylinder_math *c)
+{
+	t_vec3	dir;
+	t_vec3	top;
+	t_vec3	ext;
+	float	len;
+
+	len = vec3_length(c->axis);
+	dir = vec3_normalize(c->axis);
+	top = vec3_add(c->disk_down.point,
+			vec3_scale(dir, fmaxf(c->height / len, c->height * len)));
+	ext = disk_extent(dir, c->radius * (1.0f + AABB_EPSILON));
+	ext = vec3_add(ext, vec3_from_scalar(AABB_EPSILON));
+	return ((t_aabb){
+		.min = vec3_sub(vec3_min_comp(c->disk_down.point, top), ext),
+		.max = vec3_add(vec3_max_comp(c->disk_down.point, top), ext)
+	});
+}
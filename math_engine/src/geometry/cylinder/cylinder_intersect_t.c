@@ -0,0 +1,92 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   cylinder_intersect_t.c                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: sabruma <sabruma@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 22:35:49 by sabruma           #+#    #+#             */
+/*   Updated: 2026/10/17 22:38:53 by sabruma          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <math.h>
+#include "geometry/cylinder.h"
+
+static bool	disk_t(const t_plane_math *d, const t_ray *ray, float r_sq,
+				float *t)
+{
+	return (plane_intersect_t(d, ray, t)
+		&& !(vec3_distance_sq(ray_at(*ray, *t), d->point) > r_sq));
+}
+
+// lateral surface, like cylinder_intersect only the nearest root
+// in range is checked against the height
+static bool	side_t(const t_cylinder_math *c, const t_ray *ray, float *t)
+{
+	t_vec3	delta_rej;
+	t_vec3	dir_rej;
+	t_quad	cy_eq;
+	float	h;
+
+	delta_rej = vec3_reject(vec3_sub(ray->origin, c->disk_down.point),
+			c->axis);
+	dir_rej = vec3_reject(ray->direction, c->axis);
+	cy_eq.a = vec3_length_sq(dir_rej);
+	cy_eq.b = 2.0f * (vec3_dot(delta_rej, dir_rej));
+	cy_eq.c = vec3_length_sq(delta_rej) - c->radius_sq;
+	if (!solve_quadratic(&cy_eq))
+		return (false);
+	if (cy_eq.x0 < ray->t_min || cy_eq.x0 > ray->t_max)
+	{
+		if (cy_eq.x1 < ray->t_min || cy_eq.x1 > ray->t_max)
+			return (false);
+		cy_eq.x0 = cy_eq.x1;
+	}
+	*t = cy_eq.x0;
+	h = vec3_dot(vec3_sub(ray_at(*ray, *t), c->disk_down.point), c->axis);
+	return (h > 0.0f && h < c->height);
+}
+
+// t-only cylinder_intersect: nearest of the two caps and the side
+bool	cylinder_intersect_t(const t_cylinder_math *c, const t_ray *ray,
+			float *t)
+{
+	float	tmp;
+
+	*t = INFINITY;
+	if (disk_t(&c->disk_down, ray, c->radius_sq, &tmp) && tmp < *t)
+		*t = tmp;
+	if (disk_t(&c->disk_up, ray, c->radius_sq, &tmp) && tmp < *t)
+		*t = tmp;
+	if (side_t(c, ray, &tmp) && tmp < *t)
+		*t = tmp;
+	return (*t < INFINITY);
+}
+
+// the cap that produced t keeps its plane normal, otherwise t came from
+// the side: the radial component of the hit point, scaled to unit length
+void	cylinder_finalize(const t_cylinder_math *c, const t_ray *ray, float t,
+			t_hit *hit)
+{
+	t_vec3	delta_rej;
+	float	tmp;
+
+	hit->t = t;
+	hit->point = ray_at(*ray, t);
+	hit->color = c->color;
+	hit->ray = *ray;
+	hit->obj = OBJ_CYLINDER;
+	if (disk_t(&c->disk_down, ray, c->radius_sq, &tmp) && tmp == t)
+		hit->normal = c->disk_down.normal;
+	else if (disk_t(&c->disk_up, ray, c->radius_sq, &tmp) && tmp == t)
+		hit->normal = c->disk_up.normal;
+	else
+	{
+		delta_rej = vec3_reject(vec3_sub(ray->origin, c->disk_down.point),
+				c->axis);
+		hit->normal = vec3_add(delta_rej,
+				vec3_scale(vec3_reject(ray->direction, c->axis), t));
+		hit->normal = vec3_scale(hit->normal, 1.0f / c->radius);
+	}
+}
@@ -0,0 +1,74 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   packet.c                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: sabruma <sabruma@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 22:47:09 by sabruma           #+#    #+#             */
+/*   Updated: 2026/10/17 22:47:09 by sabruma          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "geometry/ray_packet.h"
+#include "core/constants.h"
+#include <math.h>
+
+static void	packet_set(t_ray_packet *p, int lane, const t_ray *ray)
+{
+	t_vec3	inv;
+
+	inv = vec3_div_comp(vec3_one(), ray->direction);
+	p->ox[lane] = ray->origin.x;
+	p->oy[lane] = ray->origin.y;
+	p->oz[lane] = ray->origin.z;
+	p->dx[lane] = ray->direction.x;
+	p->dy[lane] = ray->direction.y;
+	p->dz[lane] = ray->direction.z;
+	p->ix[lane] = inv.x;
+	p->iy[lane] = inv.y;
+	p->iz[lane] = inv.z;
+	p->t_min[lane] = ray->t_min;
+	p->t_max[lane] = ray->t_max;
+	p->best[lane] = INFINITY;
+}
+
+// loads the lanes set in active from rays, the others copy an active ray
+// (so they hold no NaN) and are switched off through t_max and best
+void	packet_init(t_ray_packet *p, const t_ray *rays, int active)
+{
+	int	first;
+	int	lane;
+
+	first = __builtin_ctz(active);
+	lane = 0;
+	while (lane < PACKET_SIZE)
+	{
+		if (active & (1 << lane))
+			packet_set(p, lane, &rays[lane]);
+		else
+		{
+			packet_set(p, lane, &rays[first]);
+			p->t_max[lane] = -INFINITY;
+			p->best[lane] = -INFINITY;
+		}
+		lane++;
+	}
+}
+
+// the lane as a single ray, with the narrowed t_max
+t_ray	packet_ray(const t_ray_packet *p, int lane)
+{
+	return ((t_ray){
+		.origin = {p->ox[lane], p->oy[lane], p->oz[lane]},
+		.direction = {p->dx[lane], p->dy[lane], p->dz[lane]},
+		.t_max = p->t_max[lane],
+		.t_min = p->t_min[lane]});
+}
+
+// records a closer hit found for one lane outside the packet kernels
+void	packet_hit(t_ray_packet *p, int lane, float t)
+{
+	p->best[lane] = t;
+	p->t_max[lane] = t;
+}
@@ -0,0 +1,82 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   packet_aabb.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: sabruma <sabruma@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 22:47:25 by sabruma           #+#    #+#             */
+/*   Updated: 2026/10/17 22:47:25 by sabruma          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "geometry/ray_packet.h"
+#include "core/simd.h"
+#include <math.h>
+
+#if SIMD_WIDTH > 1
+
+// slab() of aabb_intersect on every lane, same compares so NaN lanes
+// leave span untouched just the same
+static void	slab_lanes(t_vf min, t_vf max, t_vf inv, t_vf span[2])
+{
+	t_vf	t0;
+	t_vf	t1;
+	t_vf	swap;
+
+	t0 = vf_mul(min, inv);
+	t1 = vf_mul(max, inv);
+	swap = vf_lt(t1, t0);
+	min = vf_sel(swap, t1, t0);
+	max = vf_sel(swap, t0, t1);
+	span[0] = vf_sel(vf_lt(span[0], min), min, span[0]);
+	span[1] = vf_sel(vf_lt(max, span[1]), max, span[1]);
+}
+
+// lanes from g on, near gets the entry of the lanes that hit, inf elsewhere
+static int	aabb_lanes(const t_aabb *b, const t_ray_packet *p, int g,
+				t_vf *near)
+{
+	t_vf	span[2];
+	t_vf	hit;
+	t_vf	o;
+
+	span[0] = vf_loadu(p->t_min + g);
+	span[1] = vf_loadu(p->t_max + g);
+	o = vf_loadu(p->ox + g);
+	slab_lanes(vf_sub(vf_set1(b->min.x), o), vf_sub(vf_set1(b->max.x), o),
+		vf_loadu(p->ix + g), span);
+	o = vf_loadu(p->oy + g);
+	slab_lanes(vf_sub(vf_set1(b->min.y), o), vf_sub(vf_set1(b->max.y), o),
+		vf_loadu(p->iy + g), span);
+	o = vf_loadu(p->oz + g);
+	slab_lanes(vf_sub(vf_set1(b->min.z), o), vf_sub(vf_set1(b->max.z), o),
+		vf_loadu(p->iz + g), span);
+	hit = vf_and(vf_le(span[0], span[1]),
+			vf_le(span[0], vf_loadu(p->best + g)));
+	*near = vf_sel(hit, span[0], vf_set1(INFINITY));
+	return (vf_movemask(hit));
+}
+
+// lanes entering the box no farther than their closest hit so far,
+// t_near is the nearest entry among them (the order to visit boxes)
+int	packet_aabb(const t_aabb *box, const t_ray_packet *p, float *t_near)
+{
+	t_vf	near;
+	int		mask;
+	int		g;
+
+	mask = 0;
+	*t_near = INFINITY;
+	g = 0;
+	while (g < PACKET_SIZE)
+	{
+		mask |= aabb_lanes(box, p, g, &near) << g;
+		if (vf_hmin(near) < *t_near)
+			*t_near = vf_hmin(near);
+		g += SIMD_WIDTH;
+	}
+	return (mask);
+}
+
+#endif
@@ -0,0 +1,57 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   packet_plane.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: sabruma <sabruma@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 22:47:56 by sabruma           #+#    #+#             */
+/*   Updated: 2026/10/17 22:47:56 by sabruma          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "geometry/packet_lanes.h"
+#include <math.h>
+
+#if SIMD_WIDTH > 1
+
+// plane_intersect_t on every lane, (t_min, t_max) open like there.
+// 1e-6f is below 1e-6, so |div| > 1e-6f is the scalar double compare
+static t_vf	plane_lanes(const t_plane_math *pl, const t_ray_lanes *r)
+{
+	t_vf	div;
+	t_vf	t;
+
+	div = vf_add(vf_add(vf_mul(r->dx, vf_set1(pl->normal.x)),
+				vf_mul(r->dy, vf_set1(pl->normal.y))),
+			vf_mul(r->dz, vf_set1(pl->normal.z)));
+	t = vf_add(vf_add(vf_mul(r->ox, vf_set1(pl->normal.x)),
+				vf_mul(r->oy, vf_set1(pl->normal.y))),
+			vf_mul(r->oz, vf_set1(pl->normal.z)));
+	t = vf_div(vf_mul(vf_set1(-1.0f), vf_add(t, vf_set1(pl->dot))), div);
+	return (vf_sel(vf_and(vf_or(vf_lt(vf_set1(1e-6f), div),
+					vf_lt(div, vf_set1(-1e-6f))),
+				vf_and(vf_lt(r->t_min, t), vf_lt(t, r->t_max))),
+			t, vf_set1(INFINITY)));
+}
+
+// plane against the whole packet, returns the lanes it is now the
+// closest hit of
+int	plane_packet(const t_plane_math *pl, t_ray_packet *p)
+{
+	t_ray_lanes	r;
+	int			mask;
+	int			g;
+
+	mask = 0;
+	g = 0;
+	while (g < PACKET_SIZE)
+	{
+		packet_lanes(p, g, &r);
+		mask |= packet_keep(plane_lanes(pl, &r), p, g) << g;
+		g += SIMD_WIDTH;
+	}
+	return (mask);
+}
+
+#endif
@@ -0,0 +1,90 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   packet_scalar.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: sabruma <sabruma@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 22:48:05 by sabruma           #+#    #+#             */
+/*   Updated: 2026/10/17 22:48:05 by sabruma          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "geometry/ray_packet.h"
+#include "core/simd.h"
+#include <math.h>
+
+#if SIMD_WIDTH == 1
+
+// fallback for targets without SSE2: the scalar tests lane by lane
+
+int	packet_aabb(const t_aabb *box, const t_ray_packet *p, float *t_near)
+{
+	t_ray	ray;
+	float	t;
+	int		mask;
+	int		lane;
+
+	mask = 0;
+	*t_near = INFINITY;
+	lane = -1;
+	while (++lane < PACKET_SIZE)
+	{
+		ray = packet_ray(p, lane);
+		if (aabb_intersect(box, &ray, (t_vec3){p->ix[lane], p->iy[lane],
+			p->iz[lane]}, &t) && t <= p->best[lane])
+		{
+			mask |= 1 << lane;
+			if (t < *t_near)
+				*t_near = t;
+		}
+	}
+	return (mask);
+}
+
+int	sphere_packet(const t_sphere_soa *soa, int i, t_ray_packet *p)
+{
+	t_sphere_math	sp;
+	t_ray			ray;
+	float			t;
+	int				mask;
+	int				lane;
+
+	sp.center = (t_vec3){soa->x[i], soa->y[i], soa->z[i]};
+	sp.radius_sq = soa->r2[i];
+	mask = 0;
+	lane = -1;
+	while (++lane < PACKET_SIZE)
+	{
+		ray = packet_ray(p, lane);
+		if (sphere_intersect_t(&sp, &ray, &t) && t < p->best[lane])
+		{
+			packet_hit(p, lane, t);
+			mask |= 1 << lane;
+		}
+	}
+	return (mask);
+}
+
+int	plane_packet(const t_plane_math *pl, t_ray_packet *p)
+{
+	t_ray	ray;
+	float	t;
+	int		mask;
+	int		lane;
+
+	mask = 0;
+	lane = -1;
+	while (++lane < PACKET_SIZE)
+	{
+		ray = packet_ray(p, lane);
+		if (plane_intersect_t(pl, &ray, &t) && t < p->best[lane])
+		{
+			packet_hit(p, lane, t);
+			mask |= 1 << lane;
+		}
+	}
+	return (mask);
+}
+
+#endif
@@ -0,0 +1,56 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   packet_sphere.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: sabruma <sabruma@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 22:47:56 by sabruma           #+#    #+#             */
+/*   Updated: 2026/10/17 22:47:56 by sabruma          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "geometry/packet_lanes.h"
+
+#if SIMD_WIDTH > 1
+
+// b and c of sphere i against every lane, the mirror of batch_quad
+static void	packet_quad(const t_sphere_soa *s, int i, const t_ray_lanes *r,
+				t_quad_lanes *q)
+{
+	t_vf	dx;
+	t_vf	dy;
+	t_vf	dz;
+
+	dx = vf_sub(r->ox, vf_set1(s->x[i]));
+	dy = vf_sub(r->oy, vf_set1(s->y[i]));
+	dz = vf_sub(r->oz, vf_set1(s->z[i]));
+	q->b = vf_mul(vf_set1(2.0f), vf_add(vf_add(vf_mul(r->dx, dx),
+					vf_mul(r->dy, dy)), vf_mul(r->dz, dz)));
+	q->c = vf_sub(vf_add(vf_add(vf_mul(dx, dx), vf_mul(dy, dy)),
+				vf_mul(dz, dz)), vf_set1(s->r2[i]));
+}
+
+// sphere i against the whole packet: returns the lanes it is now
+// the closest hit of, those lanes are narrowed to it
+int	sphere_packet(const t_sphere_soa *soa, int i, t_ray_packet *p)
+{
+	t_ray_lanes		r;
+	t_quad_lanes	q;
+	int				mask;
+	int				g;
+
+	mask = 0;
+	g = 0;
+	while (g < PACKET_SIZE)
+	{
+		packet_lanes(p, g, &r);
+		packet_quad(soa, i, &r, &q);
+		lanes_solve(&q, &r);
+		mask |= packet_keep(lanes_pick(&q, &r), p, g) << g;
+		g += SIMD_WIDTH;
+	}
+	return (mask);
+}
+
+#endif
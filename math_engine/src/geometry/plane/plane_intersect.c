@@ -6,34 +6,32 @@
 /*   By: sabruma <sabruma@student.42firenze.it>     +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2026/03/18 21:43:01 by sabruma           #+#    #+#             */
-/*   Updated: 2026/03/19 22:40:25 by sabruma          ###   ########.fr       */
+/*   Updated: 2026/10/17 22:38:53 by sabruma          ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
-#include <math.h>
 #include "geometry/plane.h"
 
+// second phase: fills the hit for the plane that won the t-only tests
+void	plane_finalize(const t_plane_math *p, const t_ray *ray, float t,
+			t_hit *hit)
+{
+	hit->t = t;
+	hit->color = p->color;
+	hit->point = ray_at(*ray, t);
+	hit->normal = p->normal;
+	hit->ray = *ray;
+	hit->obj = OBJ_PLANE;
+}
+
 bool	plane_intersect(t_plane_math *p, t_ray ray, t_hit *hit)
 {
-	float	div;
 	float	t;
 
-	div = vec3_dot(ray.direction, p->normal);
-	if (fabsf(div) > 1e-6)
-	{
-		t = -(vec3_dot(ray.origin, p->normal) + p->dot) / div;
-		if (t > ray.t_min && t < ray.t_max)
-		{
-			hit->t = t;
-			hit->color = p->color;
-			hit->point = ray_at(ray, t);
-			hit->normal = p->normal;
-			hit->ray = ray;
-			hit->obj = OBJ_PLANE;
-			return (true);
-		}
-	}
-	return (false);
+	if (!plane_intersect_t(p, &ray, &t))
+		return (false);
+	plane_finalize(p, &ray, t, hit);
+	return (true);
 }
 
 // bool	plane_intersect(t_plane_math *p, t_ray ray, t_hit *hit)
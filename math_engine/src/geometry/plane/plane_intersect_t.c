@@ -0,0 +1,26 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   plane_intersect_t.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: sabruma <sabruma@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 22:35:49 by sabruma           #+#    #+#             */
+/*   Updated: 2026/10/17 22:35:49 by sabruma          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <math.h>
+#include "geometry/plane.h"
+
+// t-only plane_intersect, t must fall strictly inside (t_min, t_max)
+bool	plane_intersect_t(const t_plane_math *p, const t_ray *ray, float *t)
+{
+	float	div;
+
+	div = vec3_dot(ray->direction, p->normal);
+	if (!(fabsf(div) > 1e-6))
+		return (false);
+	*t = -(vec3_dot(ray->origin, p->normal) + p->dot) / div;
+	return (*t > ray->t_min && *t < ray->t_max);
+}
@@ -0,0 +1,24 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   sphere_bounds.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: sabruma <sabruma@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 22:27:00 by sabruma           #+#    #+#             */
+/*   Updated: 2026/10/17 22:27:00 by sabruma          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "geometry/sphere.h"
+
+t_aabb	sphere_bounds(const t_sphere_math *s)
+{
+	t_vec3	r;
+
+	r = vec3_from_scalar(s->radius * (1.0f + AABB_EPSILON) + AABB_EPSILON);
+	return ((t_aabb){
+		.min = vec3_sub(s->center, r),
+		.max = vec3_add(s->center, r)
+	});
+}
@@ -6,40 +6,33 @@
 /*   By: sabruma <sabruma@student.42firenze.it>     +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2026/03/18 10:01:42 by sabruma           #+#    #+#             */
-/*   Updated: 2026/03/23 01:04:22 by sabruma          ###   ########.fr       */
+/*   Updated: 2026/10/17 22:38:53 by sabruma          ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "geometry/sphere.h"
-#include <math.h>
-#include <stdio.h>
+
+// second phase: fills the hit for the sphere that won the t-only tests
+void	sphere_finalize(const t_sphere_math *s, const t_ray *ray, float t,
+			t_hit *hit)
+{
+	hit->t = t;
+	hit->color = s->color;
+	hit->point = ray_at(*ray, t);
+	hit->normal = vec3_normalize(vec3_sub(hit->point, s->center));
+	hit->ray = *ray;
+	hit->obj = OBJ_SPHERE;
+}
 
 // computes ray-sphere intersection (analytical)
-// initializes hit if there's a collision, otherwise returns false 
+// initializes hit if there's a collision, otherwise returns false
 // a = 1 if ray.direction is normalized
 bool	sphere_intersect(t_sphere_math *s, t_ray ray, t_hit *hit)
 {
-	t_quad	sphere_eq;
-	t_vec3	distance;
+	float	t;
 
-	distance = vec3_sub(ray.origin, s->center);
-	sphere_eq.a = vec3_length_sq(ray.direction);
-	sphere_eq.b = 2 * vec3_dot(ray.direction, distance);
-	sphere_eq.c = vec3_length_sq(distance) - s->radius_sq;
-	sphere_eq.x1 = NAN;
-	if (!solve_quadratic(&sphere_eq))
+	if (!sphere_intersect_t(s, &ray, &t))
 		return (false);
-	if (sphere_eq.x0 < ray.t_min || sphere_eq.x0 > ray.t_max)
-	{
-		if (sphere_eq.x1 < ray.t_min || sphere_eq.x1 > ray.t_max)
-			return (false);
-		sphere_eq.x0 = sphere_eq.x1;
-	}
-	hit->t = sphere_eq.x0;
-	hit->color = s->color;
-	hit->point = ray_at(ray, hit->t);
-	hit->normal = vec3_normalize(vec3_sub(hit->point, s->center));
-	hit->ray = ray;
-	hit->obj = OBJ_SPHERE;
+	sphere_finalize(s, &ray, t, hit);
 	return (true);
 }
@@ -0,0 +1,80 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   sphere_intersect_n.c                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: sabruma <sabruma@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 22:41:31 by sabruma           #+#    #+#             */
+/*   Updated: 2026/10/17 22:54:19 by sabruma          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "geometry/sphere_lanes.h"
+#include "utils/math_constants.h"
+#include <math.h>
+
+#if SIMD_WIDTH > 1
+
+static void	ray_lanes(const t_ray *ray, t_ray_lanes *r)
+{
+	r->ox = vf_set1(ray->origin.x);
+	r->oy = vf_set1(ray->origin.y);
+	r->oz = vf_set1(ray->origin.z);
+	r->dx = vf_set1(ray->direction.x);
+	r->dy = vf_set1(ray->direction.y);
+	r->dz = vf_set1(ray->direction.z);
+	r->a = vf_set1(vec3_length_sq(ray->direction));
+	r->t_min = vf_set1(ray->t_min);
+	r->t_max = vf_set1(ray->t_max);
+	r->eps = vf_set1(math_epsilon());
+}
+
+// b and c of the quadratic for the batch starting at sphere i,
+// same operations in the same order as sphere_intersect_t
+static void	batch_quad(const t_sphere_soa *s, const t_ray_lanes *r, int i,
+				t_quad_lanes *q)
+{
+	t_vf	dx;
+	t_vf	dy;
+	t_vf	dz;
+
+	dx = vf_sub(r->ox, vf_loadu(s->x + i));
+	dy = vf_sub(r->oy, vf_loadu(s->y + i));
+	dz = vf_sub(r->oz, vf_loadu(s->z + i));
+	q->b = vf_mul(vf_set1(2.0f), vf_add(vf_add(vf_mul(r->dx, dx),
+					vf_mul(r->dy, dy)), vf_mul(r->dz, dz)));
+	q->c = vf_sub(vf_add(vf_add(vf_mul(dx, dx), vf_mul(dy, dy)),
+				vf_mul(dz, dz)), vf_loadu(s->r2 + i));
+}
+
+// closest of the spheres range[0] .. range[0] + range[1] - 1 nearer than *t,
+// SIMD_WIDTH at a time. returns its index and updates *t, -1 if none is.
+// ties go to the lowest index like a scalar loop with a strict compare
+int	sphere_intersect_n(const t_sphere_soa *soa, const t_ray *ray,
+		const int range[2], float *t)
+{
+	t_ray_lanes		r;
+	t_quad_lanes	q;
+	int				i;
+	int				lane;
+	int				best;
+
+	ray_lanes(ray, &r);
+	best = -1;
+	i = range[0];
+	while (i < range[0] + range[1])
+	{
+		batch_quad(soa, &r, i, &q);
+		lanes_solve(&q, &r);
+		lane = vf_argmin_below(vf_sel(vf_lt(vf_lanes(),
+						vf_set1((float)(range[0] + range[1] - i))),
+					lanes_pick(&q, &r), vf_set1(INFINITY)), t);
+		if (lane >= 0)
+			best = i + lane;
+		i += SIMD_WIDTH;
+	}
+	return (best);
+}
+
+#endif
@@ -0,0 +1,50 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   sphere_intersect_scalar.c                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: sabruma <sabruma@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 22:42:24 by sabruma           #+#    #+#             */
+/*   Updated: 2026/10/17 22:42:24 by sabruma          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "geometry/sphere_soa.h"
+#include "core/simd.h"
+
+#if SIMD_WIDTH == 1
+
+// fallback for targets without SSE2, one sphere at a time
+static bool	sphere_root(const t_sphere_soa *s, const t_ray *ray, int i,
+				float *t)
+{
+	t_sphere_math	sp;
+
+	sp.center = (t_vec3){s->x[i], s->y[i], s->z[i]};
+	sp.radius_sq = s->r2[i];
+	return (sphere_intersect_t(&sp, ray, t));
+}
+
+int	sphere_intersect_n(const t_sphere_soa *soa, const t_ray *ray,
+		const int range[2], float *t)
+{
+	float	root;
+	int		i;
+	int		best;
+
+	best = -1;
+	i = range[0];
+	while (i < range[0] + range[1])
+	{
+		if (sphere_root(soa, ray, i, &root) && root < *t)
+		{
+			*t = root;
+			best = i;
+		}
+		i++;
+	}
+	return (best);
+}
+
+#endif
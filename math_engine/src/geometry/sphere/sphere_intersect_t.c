@@ -0,0 +1,36 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   sphere_intersect_t.c                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: sabruma <sabruma@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 22:35:49 by sabruma           #+#    #+#             */
+/*   Updated: 2026/10/17 22:35:49 by sabruma          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "geometry/sphere.h"
+
+// same test as sphere_intersect but only the distance comes out:
+// the nearest root inside [t_min, t_max]
+bool	sphere_intersect_t(const t_sphere_math *s, const t_ray *ray, float *t)
+{
+	t_quad	sphere_eq;
+	t_vec3	distance;
+
+	distance = vec3_sub(ray->origin, s->center);
+	sphere_eq.a = vec3_length_sq(ray->direction);
+	sphere_eq.b = 2 * vec3_dot(ray->direction, distance);
+	sphere_eq.c = vec3_length_sq(distance) - s->radius_sq;
+	if (!solve_quadratic(&sphere_eq))
+		return (false);
+	if (sphere_eq.x0 < ray->t_min || sphere_eq.x0 > ray->t_max)
+	{
+		if (sphere_eq.x1 < ray->t_min || sphere_eq.x1 > ray->t_max)
+			return (false);
+		sphere_eq.x0 = sphere_eq.x1;
+	}
+	*t = sphere_eq.x0;
+	return (true);
+}
@@ -0,0 +1,75 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   sphere_soa.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: sabruma <sabruma@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 22:41:31 by sabruma           #+#    #+#             */
+/*   Updated: 2026/10/17 23:35:21 by sabruma          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "geometry/sphere_soa.h"
+#include <math.h>
+
+// each float array rounded up to the alignment so every array starts
+// aligned too
+static size_t	soa_stride(int count)
+{
+	size_t	n;
+
+	n = SPHERE_SOA_ALIGN / sizeof(float);
+	return ((count + SPHERE_SOA_PAD + n - 1) / n * n);
+}
+
+// bytes sphere_soa_init needs: the four float arrays, then the colors
+size_t	sphere_soa_size(int count)
+{
+	return (4 * soa_stride(count) * sizeof(float)
+		+ (count + 1) * sizeof(t_vec3));
+}
+
+// mem is caller memory of sphere_soa_size(count) bytes,
+// SPHERE_SOA_ALIGN aligned. nothing to free afterwards
+void	sphere_soa_init(t_sphere_soa *soa, void *mem, const t_sphere_math *sp,
+			int count)
+{
+	size_t	stride;
+	size_t	i;
+
+	stride = soa_stride(count);
+	*soa = (t_sphere_soa){.x = mem, .count = count};
+	soa->y = soa->x + stride;
+	soa->z = soa->y + stride;
+	soa->r2 = soa->z + stride;
+	soa->color = (t_vec3 *)(soa->x + 4 * stride);
+	i = 0;
+	while (i < 4 * stride)
+		soa->x[i++] = NAN;
+	i = 0;
+	while (i < (size_t)count)
+	{
+		soa->x[i] = sp[i].center.x;
+		soa->y[i] = sp[i].center.y;
+		soa->z[i] = sp[i].center.z;
+		soa->r2[i] = sp[i].radius_sq;
+		soa->color[i] = sp[i].color;
+		i++;
+	}
+}
+
+// second phase for a sphere found by sphere_intersect_n, hit->t must
+// already hold its distance
+void	sphere_soa_finalize(const t_sphere_soa *soa, int i, const t_ray *ray,
+			t_hit *hit)
+{
+	t_vec3	center;
+
+	center = (t_vec3){soa->x[i], soa->y[i], soa->z[i]};
+	hit->color = soa->color[i];
+	hit->point = ray_at(*ray, hit->t);
+	hit->normal = vec3_normalize(vec3_sub(hit->point, center));
+	hit->ray = *ray;
+	hit->obj = OBJ_SPHERE;
+}
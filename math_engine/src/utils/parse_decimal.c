@@ -0,0 +1,80 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   parse_decimal.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: sabruma <sabruma@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:16:36 by sabruma           #+#    #+#             */
+/*   Updated: 2026/10/17 23:16:36 by sabruma          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "utils/parse_float.h"
+
+// leading zeros only move the decimal point, past 19 significant digits
+// the integer part still scales the number and the rest is just noted
+static const char	*scan_digits(const char *s, t_decimal *d, bool fraction)
+{
+	while (*s >= '0' && *s <= '9')
+	{
+		if (d->digits < DECIMAL_DIGITS)
+		{
+			d->w = d->w * 10 + (*s - '0');
+			d->digits += d->w != 0;
+			d->q -= fraction;
+		}
+		else
+		{
+			d->q += !fraction;
+			d->truncated |= *s != '0';
+		}
+		s++;
+	}
+	return (s);
+}
+
+// huge exponents are clamped, they end up 0 or inf anyway
+static const char	*scan_exponent(const char *s, t_decimal *d)
+{
+	const char	*p;
+	int64_t		e;
+	bool		negative;
+
+	p = s + 1;
+	negative = *p == '-';
+	if (*p == '+' || *p == '-')
+		p++;
+	if (*p < '0' || *p > '9')
+		return (s);
+	e = 0;
+	while (*p >= '0' && *p <= '9')
+	{
+		if (e < 100000)
+			e = e * 10 + (*p - '0');
+		p++;
+	}
+	if (negative)
+		e = -e;
+	d->q += e;
+	return (p);
+}
+
+const char	*scan_decimal(const char *s, t_decimal *d)
+{
+	const char	*start;
+
+	*d = (t_decimal){0};
+	d->negative = *s == '-';
+	if (*s == '+' || *s == '-')
+		s++;
+	start = s;
+	s = scan_digits(s, d, false);
+	if (*s == '.')
+		s = scan_digits(s + 1, d, true);
+	if (s == start || (s == start + 1 && *start == '.'))
+		return (NULL);
+	if (*s == 'e' || *s == 'E')
+		s = scan_exponent(s, d);
+	return (s);
+}
@@ -0,0 +1,71 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   parse_double.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: sabruma <sabruma@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:16:53 by sabruma           #+#    #+#             */
+/*   Updated: 2026/10/17 23:16:53 by sabruma          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "utils/parse_float.h"
+#include <stdlib.h>
+#include <string.h>
+
+static const t_binary_format	g_binary64 = {52, -1023, 0x7FF, -342, 308,
+	-4, 23};
+
+static const double				g_pow10_double[] = {1e0, 1e1, 1e2, 1e3,
+	1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11, 1e12, 1e13, 1e14, 1e15, 1e16,
+	1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+// Clinger: w and 10^|q| are both exact doubles, so one multiply or
+// divide rounds once, correctly (needs SSE math, not x87)
+static bool	fast_path(const t_decimal *d, double *out)
+{
+	if (d->truncated || d->w > (uint64_t)1 << 53 || d->q < -22 || d->q > 22)
+		return (false);
+	*out = (double)d->w;
+	if (d->q < 0)
+		*out /= g_pow10_double[-d->q];
+	else
+		*out *= g_pow10_double[d->q];
+	if (d->negative)
+		*out = -*out;
+	return (true);
+}
+
+// with dropped digits the value is between w and w + 1: when both round
+// the same way so does the input, otherwise it is left to the libc
+static bool	slow_path(const t_decimal *d, double *out)
+{
+	t_adjusted	r;
+	t_adjusted	up;
+	uint64_t	bits;
+
+	r = eisel_lemire(&g_binary64, d->q, d->w);
+	if (d->truncated)
+	{
+		up = eisel_lemire(&g_binary64, d->q, d->w + 1);
+		if (r.mantissa != up.mantissa || r.power2 != up.power2)
+			return (false);
+	}
+	bits = r.mantissa | (uint64_t)r.power2 << 52 | (uint64_t)d->negative << 63;
+	memcpy(out, &bits, sizeof(bits));
+	return (true);
+}
+
+const char	*parse_double(const char *s, double *out)
+{
+	t_decimal	d;
+	const char	*end;
+
+	end = scan_decimal(s, &d);
+	if (!end)
+		return (NULL);
+	if (!fast_path(&d, out) && !slow_path(&d, out))
+		*out = strtod(s, NULL);
+	return (end);
+}
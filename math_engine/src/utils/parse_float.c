@@ -0,0 +1,70 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   parse_float.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: sabruma <sabruma@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:16:53 by sabruma           #+#    #+#             */
+/*   Updated: 2026/10/17 23:16:53 by sabruma          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "utils/parse_float.h"
+#include <stdlib.h>
+#include <string.h>
+
+static const t_binary_format	g_binary32 = {23, -127, 0xFF, -64, 38,
+	-17, 10};
+
+static const float				g_pow10_float[] = {1e0f, 1e1f, 1e2f, 1e3f,
+	1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f};
+
+// same as the double version: 10^10 is the last power of ten whose
+// factor 5^10 still fits the 24 bit mantissa
+static bool	fast_path(const t_decimal *d, float *out)
+{
+	if (d->truncated || d->w > (uint64_t)1 << 24 || d->q < -10 || d->q > 10)
+		return (false);
+	*out = (float)d->w;
+	if (d->q < 0)
+		*out /= g_pow10_float[-d->q];
+	else
+		*out *= g_pow10_float[d->q];
+	if (d->negative)
+		*out = -*out;
+	return (true);
+}
+
+static bool	slow_path(const t_decimal *d, float *out)
+{
+	t_adjusted	r;
+	t_adjusted	up;
+	uint32_t	bits;
+
+	r = eisel_lemire(&g_binary32, d->q, d->w);
+	if (d->truncated)
+	{
+		up = eisel_lemire(&g_binary32, d->q, d->w + 1);
+		if (r.mantissa != up.mantissa || r.power2 != up.power2)
+			return (false);
+	}
+	bits = (uint32_t)r.mantissa | (uint32_t)r.power2 << 23
+		| (uint32_t)d->negative << 31;
+	memcpy(out, &bits, sizeof(bits));
+	return (true);
+}
+
+// rounded straight to float: going through double would round twice
+const char	*parse_float(const char *s, float *out)
+{
+	t_decimal	d;
+	const char	*end;
+
+	end = scan_decimal(s, &d);
+	if (!end)
+		return (NULL);
+	if (!fast_path(&d, out) && !slow_path(&d, out))
+		*out = strtof(s, NULL);
+	return (end);
+}
@@ -0,0 +1,12 @@
+#include "core/test.h"
+
+int main(void)
+{
+	test_color_transfer();
+#ifdef BENCHMARK
+	printf("✓ ALL COLOR BECNHMARKS COMPLETE!\n");
+#else
+	printf("✓ ALL COLOR TESTS PASSED!\n");
+#endif
+	return 0;
+}
@@ -0,0 +1,318 @@
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <assert.h>
+#include <stdint.h>
+#include "core/color.h"
+#include "core/test.h"
+#include "dispatch/isa.h"
+
+// exact curves in double, the references for the fast versions
+static double srgb_decode_ref(double v)
+{
+	if (v <= 0.04045)
+		return v / 12.92;
+	return pow((v + 0.055) / 1.055, 2.4);
+}
+
+static double srgb_encode_ref(double x)
+{
+	if (x <= 0.0031308)
+		return x * 12.92;
+	return 1.055 * pow(x, 1.0 / 2.4) - 0.055;
+}
+
+// ============================================
+// UNIT TESTS - 8 bit sRGB -> linear table
+// ============================================
+
+static void test_srgb8_to_linear_table(void)
+{
+	// Every entry is the exact value rounded to float
+	for (int i = 0; i < 256; i++)
+	{
+		double exact = srgb_decode_ref(i / 255.0);
+		assert(srgb8_to_linear((uint8_t)i) == (float)exact);
+	}
+	assert(srgb8_to_linear(0) == 0.0f);
+	assert(srgb8_to_linear(255) == 1.0f);
+
+	// And agrees with the powf version
+	for (int i = 0; i < 256; i++)
+	{
+		t_vec3 slow = vec3_srgb_to_linear(vec3_new(i / 255.0f, 0.0f, 0.0f));
+		assert(float_equal(srgb8_to_linear((uint8_t)i), slow.x, 1e-6f));
+	}
+
+	// Batch == scalar
+	uint8_t in[300];
+	float out[300];
+	for (int i = 0; i < 300; i++)
+		in[i] = (uint8_t)(i * 7);
+	srgb8_to_linear_n(in, out, 300);
+	for (int i = 0; i < 300; i++)
+		assert(out[i] == srgb8_to_linear(in[i]));
+
+	printf("✓ ");
+}
+
+// ============================================
+// UNIT TESTS - linear -> sRGB polynomial
+// ============================================
+
+static void test_linear_to_srgb_fast_bound(void)
+{
+	// Dense sweep of [0, 1], the documented bound is 7e-6
+	double max_err = 0.0;
+	for (int i = 0; i <= 1000000; i++)
+	{
+		float x = i / 1000000.0f;
+		double err = fabs(linear_to_srgb_fast(x) - srgb_encode_ref(x));
+		if (err > max_err)
+			max_err = err;
+	}
+	assert(max_err < 7e-6);
+
+	// Far below half an 8 bit step: quantized results never move by more
+	// than one and almost always match
+	int moved = 0;
+	for (int i = 0; i <= 100000; i++)
+	{
+		float x = i / 100000.0f;
+		int fast = (int)(linear_to_srgb_fast(x) * 255.0f + 0.5f);
+		int exact = (int)(srgb_encode_ref(x) * 255.0 + 0.5);
+		assert(abs(fast - exact) <= 1);
+		moved += fast != exact;
+	}
+	assert(moved < 100);
+
+	printf("✓ ");
+}
+
+static void test_linear_to_srgb_fast_edges(void)
+{
+	// Clamped to [0, 1], NaN goes to 0
+	assert(linear_to_srgb_fast(0.0f) == 0.0f);
+	assert(linear_to_srgb_fast(-1.0f) == 0.0f);
+	assert(linear_to_srgb_fast(NAN) == 0.0f);
+	assert(float_equal(linear_to_srgb_fast(1.0f), 1.0f, 1e-5f));
+	assert(linear_to_srgb_fast(50.0f) == linear_to_srgb_fast(1.0f));
+	assert(linear_to_srgb_fast(INFINITY) == linear_to_srgb_fast(1.0f));
+
+	// The linear toe is exact
+	assert(linear_to_srgb_fast(0.001f) == 0.001f * 12.92f);
+	assert(linear_to_srgb_fast(0.0031308f) == 0.0031308f * 12.92f);
+
+	// Monotonic
+	float prev = 0.0f;
+	for (int i = 0; i <= 100000; i++)
+	{
+		float cur = linear_to_srgb_fast(i / 100000.0f);
+		assert(cur >= prev - 1e-7f);
+		prev = cur;
+	}
+
+	// vec3 version is per channel
+	t_vec3 c = vec3_linear_to_srgb_fast(vec3_new(0.0f, 0.2f, 1.0f));
+	assert(c.x == 0.0f);
+	assert(c.y == linear_to_srgb_fast(0.2f));
+	assert(c.z == linear_to_srgb_fast(1.0f));
+
+	printf("✓ ");
+}
+
+static void test_linear_to_srgb_batch(void)
+{
+	// Odd length so the scalar tail runs, plus values out of range
+	enum { N = 1003 };
+	float in[N];
+	float out[N];
+	for (int i = 0; i < N; i++)
+		in[i] = random_float(-0.2f, 1.2f);
+	in[5] = NAN;
+	in[6] = INFINITY;
+	in[7] = 0.0031308f;
+	in[N - 1] = 0.5f;
+	linear_to_srgb_n(in, out, N);
+	for (int i = 0; i < N; i++)
+		assert(float_equal(out[i], linear_to_srgb_fast(in[i]), 1e-6f));
+	assert(out[5] == 0.0f);
+
+	// In place
+	linear_to_srgb_n(in, in, N);
+	for (int i = 0; i < N; i++)
+		assert(in[i] == out[i]);
+
+	printf("✓ ");
+}
+
+static void test_isa_levels(void)
+{
+	// Every level this cpu has must give the SSE2 results bit for bit
+	enum { N = 1003 };
+	float in[N];
+	float ref[N];
+	float out[N];
+	uint32_t px[N];
+	uint8_t rgb_ref[3 * N];
+	uint8_t rgb[3 * N];
+	for (int i = 0; i < N; i++)
+	{
+		in[i] = random_float(-0.2f, 1.2f);
+		px[i] = (uint32_t)rand() & 0xffffff;
+	}
+	assert(isa_select(ISA_SSE2) == 0);
+	linear_to_srgb_n(in, ref, N);
+	rgb_pack_n(px, rgb_ref, N);
+	assert(rgb_ref[0] == (px[0] >> 16 & 0xff) && rgb_ref[5] == (px[1] & 0xff));
+	for (t_isa isa = ISA_AVX2; isa <= isa_detect(); isa++)
+	{
+		assert(isa_select(isa) == 0 && isa_current() == isa);
+		linear_to_srgb_n(in, out, N);
+		rgb_pack_n(px, rgb, N);
+		for (int i = 0; i < N; i++)
+			assert(out[i] == ref[i]);
+		for (int i = 0; i < 3 * N; i++)
+			assert(rgb[i] == rgb_ref[i]);
+	}
+	assert(isa_select(ISA_AUTO) == 0 && isa_current() == isa_detect());
+
+	t_isa isa;
+	assert(isa_parse("avx2", &isa) && isa == ISA_AVX2);
+	assert(!isa_parse("avx", &isa));
+
+	printf("✓ ");
+}
+
+// ============================================
+// UNIT TESTS - srgb -> linear -> gamma 2 -> srgb shortcut
+// ============================================
+
+static void test_srgb_gamma2(void)
+{
+	// Same as the three step chain over the range the renderer uses
+	for (int i = 0; i < 10000; i++)
+	{
+		t_vec3 c = random_vec3(0.0f, 255.0f);
+		if (i < 100)
+			c = random_vec3(0.0f, 0.05f);
+		t_vec3 slow = vec3_linear_to_srgb(vec3_gamma_correct(
+			vec3_srgb_to_linear(c), 2.0f));
+		t_vec3 fast = vec3_srgb_gamma2(c);
+		float eps = 1e-5f * fmaxf(1.0f, fmaxf(slow.x, fmaxf(slow.y, slow.z)));
+		assert(vec3_equal_eps(fast, slow, eps));
+	}
+	assert(vec3_equal_eps(vec3_srgb_gamma2(vec3_new(0.0f, 0.0f, 0.0f)),
+		vec3_new(0.0f, 0.0f, 0.0f), 1e-9f));
+
+	printf("✓ ");
+}
+
+// ============================================
+// BENCHMARKS
+// ============================================
+
+#ifdef BENCHMARK
+
+#include <time.h>
+
+#define BENCH_BATCH 4096
+
+static void benchmark_linear_to_srgb(void)
+{
+	static float in[BENCH_BATCH];
+	static float out[BENCH_BATCH];
+	struct timespec t1, t2;
+	int rounds = TEST_ITERATIONS / BENCH_BATCH;
+
+	for (int i = 0; i < BENCH_BATCH; i++)
+		in[i] = (float)i / BENCH_BATCH;
+
+	clock_gettime(CLOCK_MONOTONIC, &t1);
+	for (int r = 0; r < rounds; r++)
+		for (int i = 0; i < BENCH_BATCH; i += 3)
+		{
+			t_vec3 c = vec3_linear_to_srgb(vec3_new(in[i], in[i], in[i]));
+			out[i] = c.x;
+		}
+	clock_gettime(CLOCK_MONOTONIC, &t2);
+	double sec = time_diff_sec(t1, t2);
+	printf("vec3_linear_to_srgb (powf): %.1f Mvalues/s\n",
+		   rounds * (double)BENCH_BATCH / sec / 1e6);
+
+	clock_gettime(CLOCK_MONOTONIC, &t1);
+	for (int r = 0; r < rounds; r++)
+		for (int i = 0; i < BENCH_BATCH; i++)
+			out[i] = linear_to_srgb_fast(in[i]);
+	clock_gettime(CLOCK_MONOTONIC, &t2);
+	sec = time_diff_sec(t1, t2);
+	printf("linear_to_srgb_fast: %.1f Mvalues/s\n",
+		   rounds * (double)BENCH_BATCH / sec / 1e6);
+
+	clock_gettime(CLOCK_MONOTONIC, &t1);
+	for (int r = 0; r < rounds; r++)
+		linear_to_srgb_n(in, out, BENCH_BATCH);
+	clock_gettime(CLOCK_MONOTONIC, &t2);
+	sec = time_diff_sec(t1, t2);
+	printf("linear_to_srgb_n: %.1f Mvalues/s\n",
+		   rounds * (double)BENCH_BATCH / sec / 1e6);
+	(void)out;
+}
+
+static void benchmark_srgb8_to_linear(void)
+{
+	static uint8_t in[BENCH_BATCH];
+	static float out[BENCH_BATCH];
+	struct timespec t1, t2;
+	int rounds = TEST_ITERATIONS / BENCH_BATCH;
+
+	for (int i = 0; i < BENCH_BATCH; i++)
+		in[i] = (uint8_t)i;
+
+	clock_gettime(CLOCK_MONOTONIC, &t1);
+	for (int r = 0; r < rounds; r++)
+		for (int i = 0; i < BENCH_BATCH; i += 3)
+		{
+			t_vec3 c = vec3_srgb_to_linear(vec3_new(in[i] / 255.0f,
+				in[i] / 255.0f, in[i] / 255.0f));
+			out[i] = c.x;
+		}
+	clock_gettime(CLOCK_MONOTONIC, &t2);
+	double sec = time_diff_sec(t1, t2);
+	printf("vec3_srgb_to_linear (powf): %.1f Mvalues/s\n",
+		   rounds * (double)BENCH_BATCH / sec / 1e6);
+
+	clock_gettime(CLOCK_MONOTONIC, &t1);
+	for (int r = 0; r < rounds; r++)
+		srgb8_to_linear_n(in, out, BENCH_BATCH);
+	clock_gettime(CLOCK_MONOTONIC, &t2);
+	sec = time_diff_sec(t1, t2);
+	printf("srgb8_to_linear_n: %.1f Mvalues/s\n",
+		   rounds * (double)BENCH_BATCH / sec / 1e6);
+	(void)out;
+}
+
+#endif // BENCHMARK
+
+// ============================================
+// MAIN TEST RUNNER
+// ============================================
+
+void test_color_transfer(void)
+{
+#ifdef BENCHMARK
+	printf("\n=== Running benchmarks (color transfer) ===\n");
+	benchmark_linear_to_srgb();
+	benchmark_srgb8_to_linear();
+#else
+	srand(42);
+
+	test_srgb8_to_linear_table();
+	test_linear_to_srgb_fast_bound();
+	test_linear_to_srgb_fast_edges();
+	test_linear_to_srgb_batch();
+	test_isa_levels();
+	test_srgb_gamma2();
+#endif
+}
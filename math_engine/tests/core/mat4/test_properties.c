@@ -122,7 +122,75 @@ static void test_mat4_inverse(void)
 		9,10,11,12
 	}};
 	t_mat4 SSinv = mat4_inverse(singular);
-	(void)SSinv; // ignore result, just check it compiles
+	assert(mat4_equal_eps(SSinv, I, EPSILON));
+
+	// Near-singular: |M| below 1e-6 falls back to the identity too
+	t_mat4 near = { .arr = {
+		1,0,0,0,
+		0,1,0,0,
+		0,0,1,1,
+		0,0,1,1.0000001f
+	}};
+	assert(mat4_equal_eps(mat4_inverse(near), I, EPSILON));
+
+	// Large scale: |M| = 1e48 overflows float, the inverse must not
+	t_mat4 big = mat4_mul(mat4_scaling((t_vec3){1e16f, 1e16f, 1e16f}), R);
+	t_mat4 big_inv = mat4_mul(mat4_transpose(R),
+			mat4_scaling((t_vec3){1e-16f, 1e-16f, 1e-16f}));
+	t_mat4 Binv = mat4_inverse(big);
+	for (int i = 0; i < 16; i++)
+		assert(fabsf(Binv.arr[i] - big_inv.arr[i]) <= 1e-22f);
+	assert(mat4_equal_eps(mat4_mul(big, Binv), I, 1e-5f));
+
+	// Small but regular scale is still inverted, not taken as singular
+	t_mat4 small = mat4_scaling((t_vec3){1e-3f, 1e-3f, 1e-3f});
+	assert(mat4_equal_eps(mat4_mul(small, mat4_inverse(small)), I, 1e-5f));
+
+	printf("✓ ");
+}
+
+static void test_mat4_inverse_random(void)
+{
+	// General inverse on random matrices: M * inv(M) = I
+	t_mat4 I = mat4_identity();
+	for (int k = 0; k < 1000; k++)
+	{
+		t_mat4 M = random_mat4(-10, 10);
+		if (fabsf(mat4_determinant(M)) < 1.0f)
+			continue;
+		assert(mat4_equal_eps(mat4_mul(M, mat4_inverse(M)), I, 1e-3f));
+	}
+	printf("✓ ");
+}
+
+static void test_mat4_inverse_affine_rigid(void)
+{
+	t_mat4 I = mat4_identity();
+	for (int k = 0; k < 1000; k++)
+	{
+		// Rigid: rotation then translation, like the camera
+		t_vec3 eye = random_vec3(-100, 100);
+		t_vec3 fw = vec3_normalize(random_vec3(-1, 1));
+		t_mat4 R = mat4_look_at_fast(eye, fw);
+		t_mat4 Rinv = mat4_inverse_rigid(R);
+		assert(mat4_equal_eps(Rinv, mat4_inverse(R), 1e-4f));
+		assert(mat4_equal_eps(mat4_mul(R, Rinv), I, 1e-4f));
+		assert(mat4_equal_eps(mat4_inverse_affine(R), Rinv, 1e-4f));
+
+		// Affine: non uniform scale, rotation and translation
+		t_mat4 A = mat4_mul(mat4_mul(mat4_scaling(random_vec3(0.5f, 4)),
+			mat4_rotation_axis(vec3_normalize(random_vec3(-1, 1)),
+				random_float(-3, 3))), mat4_translation(eye));
+		t_mat4 Ainv = mat4_inverse_affine(A);
+		assert(mat4_is_affine(Ainv, 0.0f));
+		assert(mat4_equal_eps(mat4_mul(A, Ainv), I, 1e-4f));
+		assert(mat4_equal_eps(Ainv, mat4_inverse(A), 1e-4f));
+	}
+
+	// Singular 3x3 part falls back to the identity like mat4_inverse
+	t_mat4 flat = mat4_scaling((t_vec3){1, 0, 1});
+	assert(mat4_equal_eps(mat4_inverse_affine(flat), I, EPSILON));
+	assert(mat4_equal_eps(mat4_inverse(flat), I, EPSILON));
 
 	printf("✓ ");
 }
@@ -418,11 +486,42 @@ static void bench_mat4_transpose(void)
 	(void)T;
 }
 
+// the specialised inverses on the camera matrix
+static void bench_mat4_inverse_affine_rigid(void)
+{
+	t_mat4 A = mat4_look_at_fast((t_vec3){1, 2, 3},
+		vec3_normalize((t_vec3){1, -1, 2}));
+	t_mat4 inv;
+	struct timespec t1, t2;
+
+	clock_gettime(CLOCK_MONOTONIC, &t1);
+	for (int i = 0; i < TEST_ITERATIONS; ++i)
+	{
+		inv = mat4_inverse_affine(A);
+		__asm__ volatile("" : : "g"(&inv) : "memory");
+	}
+	clock_gettime(CLOCK_MONOTONIC, &t2);
+	double sec = time_diff_sec(t1, t2);
+	printf("mat4_inverse_affine: %d ops in %.3f s -> %.1f ops/s\n",
+		   TEST_ITERATIONS, sec, TEST_ITERATIONS / sec);
+	clock_gettime(CLOCK_MONOTONIC, &t1);
+	for (int i = 0; i < TEST_ITERATIONS; ++i)
+	{
+		inv = mat4_inverse_rigid(A);
+		__asm__ volatile("" : : "g"(&inv) : "memory");
+	}
+	clock_gettime(CLOCK_MONOTONIC, &t2);
+	sec = time_diff_sec(t1, t2);
+	printf("mat4_inverse_rigid: %d ops in %.3f s -> %.1f ops/s\n",
+		   TEST_ITERATIONS, sec, TEST_ITERATIONS / sec);
+}
+
 static void run_benchmarks(void)
 {
 	printf("\n=== Running benchmarks (properties) ===\n");
 	bench_mat4_determinant();
 	bench_mat4_inverse();
+	bench_mat4_inverse_affine_rigid();
 	bench_mat4_transpose();
 }
 
@@ -441,6 +540,8 @@ void test_mat4_properties()
 #else
 	test_mat4_determinant();
 	test_mat4_inverse();
+	test_mat4_inverse_random();
+	test_mat4_inverse_affine_rigid();
 	test_mat4_transpose();
 	test_mat4_trace();
 	test_mat4_is_affine();
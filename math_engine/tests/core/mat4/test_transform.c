@@ -8,11 +8,13 @@
 #include <stdlib.h>
 #include <stdbool.h>
 #include <assert.h>
+#include <string.h>
 #include "core/mat4.h"
 #include "core/vec3.h"
 #include "core/constants.h"
 #include "utils/math_constants.h"
 #include "core/test.h"
+#include "dispatch/isa.h"
 
 #ifndef EPSILON
 # define EPSILON 1e-6f
@@ -271,6 +273,104 @@ static void test_mat4_transform_edge_cases(void)
 	printf("✓ ");
 }
 
+/*------------------------------------------------------------------------------
+  Batched transforms: same bits as the one at a time versions
+------------------------------------------------------------------------------*/
+
+// one at a time reference, w divide only for projective matrices
+static t_vec3 ref_point(t_mat4 m, t_vec3 p)
+{
+	float w = p.x * m.m03 + p.y * m.m13 + p.z * m.m23 + m.m33;
+	t_vec3 r = mat4_transform_point(m, p);
+	if (mat4_is_affine(m, 0.0f))
+		return r;
+	return (t_vec3){r.x / w, r.y / w, r.z / w};
+}
+
+static bool vec3_same(t_vec3 a, t_vec3 b)
+{
+	return memcmp(&a, &b, sizeof(a)) == 0;
+}
+
+static void test_mat4_transform_batch_aos(void)
+{
+	// Odd count so any tail runs, affine and projective matrices
+	enum { N = 37 };
+	t_vec3 in[N];
+	t_vec3 out[N];
+	t_mat4 mats[3] = {
+		mat4_look_at_fast((t_vec3){1, 2, 3}, vec3_normalize((t_vec3){1, -1, 2})),
+		random_mat4(-10, 10),
+		mat4_mul(mat4_scaling((t_vec3){2, -3, 0.5f}), mat4_translation((t_vec3){4, 5, 6}))
+	};
+	for (int i = 0; i < N; i++)
+		in[i] = random_vec3(-100, 100);
+	in[3] = (t_vec3){-0.0f, -0.0f, -0.0f};
+	for (int k = 0; k < 3; k++)
+	{
+		mat4_transform_points(&mats[k], in, out, N);
+		for (int i = 0; i < N; i++)
+			assert(vec3_same(out[i], ref_point(mats[k], in[i])));
+		mat4_transform_vectors(&mats[k], in, out, N);
+		for (int i = 0; i < N; i++)
+			assert(vec3_same(out[i], mat4_transform_vector(mats[k], in[i])));
+	}
+
+	// In place
+	t_vec3 copy[N];
+	memcpy(copy, in, sizeof(in));
+	mat4_transform_points(&mats[0], in, in, N);
+	for (int i = 0; i < N; i++)
+		assert(vec3_same(in[i], mat4_transform_point(mats[0], copy[i])));
+
+	printf("✓ ");
+}
+
+static void test_mat4_transform_batch_soa(void)
+{
+	// Every kernel level this cpu has, against the AoS results
+	enum { N = 45 };
+	float x[N], y[N], z[N];
+	float ox[N], oy[N], oz[N];
+	t_vec3 aos[N];
+	t_vec3 ref[N];
+	t_vec3_soa in = {x, y, z};
+	t_vec3_soa out = {ox, oy, oz};
+	t_mat4 mats[2] = {mat4_rotation_axis(vec3_normalize((t_vec3){1, 2, 3}), 0.7f),
+		random_mat4(-10, 10)};
+	for (int i = 0; i < N; i++)
+	{
+		aos[i] = random_vec3(-100, 100);
+		x[i] = aos[i].x;
+		y[i] = aos[i].y;
+		z[i] = aos[i].z;
+	}
+	for (t_isa isa = ISA_SSE2; isa <= isa_detect(); isa++)
+	{
+		assert(isa_select(isa) == 0);
+		for (int k = 0; k < 2; k++)
+		{
+			mat4_transform_points(&mats[k], aos, ref, N);
+			mat4_transform_points_soa(&mats[k], &in, &out, N);
+			for (int i = 0; i < N; i++)
+				assert(vec3_same((t_vec3){ox[i], oy[i], oz[i]}, ref[i]));
+			mat4_transform_vectors(&mats[k], aos, ref, N);
+			mat4_transform_vectors_soa(&mats[k], &in, &out, N);
+			for (int i = 0; i < N; i++)
+				assert(vec3_same((t_vec3){ox[i], oy[i], oz[i]}, ref[i]));
+		}
+	}
+	assert(isa_select(ISA_AUTO) == 0);
+
+	// In place
+	mat4_transform_points_soa(&mats[0], &in, &in, N);
+	for (int i = 0; i < N; i++)
+		assert(vec3_same((t_vec3){x[i], y[i], z[i]},
+			mat4_transform_point(mats[0], aos[i])));
+
+	printf("✓ ");
+}
+
 /*------------------------------------------------------------------------------
   Benchmark (optional)
 ------------------------------------------------------------------------------*/
@@ -351,6 +451,50 @@ static void bench_mat4_transform_normal2(void)
 	(void)r;
 }
 
+// points of a big array: one call each against the batched kernels
+static void bench_mat4_transform_batch(void)
+{
+	enum { N = 4096 };
+	static t_vec3 in[N], out[N];
+	static float x[N], y[N], z[N];
+	t_vec3_soa soa = {x, y, z};
+	t_mat4 M = mat4_look_at_fast((t_vec3){1, 2, 3},
+		vec3_normalize((t_vec3){1, -1, 2}));
+	int reps = TEST_ITERATIONS / N;
+	struct timespec t1, t2;
+
+	for (int i = 0; i < N; i++)
+	{
+		in[i] = random_vec3(-100, 100);
+		x[i] = in[i].x;
+		y[i] = in[i].y;
+		z[i] = in[i].z;
+	}
+	clock_gettime(CLOCK_MONOTONIC, &t1);
+	for (int r = 0; r < reps; r++)
+	{
+		for (int i = 0; i < N; i++)
+			out[i] = mat4_transform_point(M, in[i]);
+		__asm__ volatile("" : : "g"(out) : "memory");
+	}
+	clock_gettime(CLOCK_MONOTONIC, &t2);
+	double one = time_diff_sec(t1, t2);
+	clock_gettime(CLOCK_MONOTONIC, &t1);
+	for (int r = 0; r < reps; r++)
+		mat4_transform_points(&M, in, out, N);
+	clock_gettime(CLOCK_MONOTONIC, &t2);
+	double aos = time_diff_sec(t1, t2);
+	clock_gettime(CLOCK_MONOTONIC, &t1);
+	for (int r = 0; r < reps; r++)
+		mat4_transform_points_soa(&M, &soa, &soa, N);
+	clock_gettime(CLOCK_MONOTONIC, &t2);
+	double soa_s = time_diff_sec(t1, t2);
+	printf("mat4_transform_point loop: %.1f Mpoints/s\n", reps * N / one / 1e6);
+	printf("mat4_transform_points:     %.1f Mpoints/s\n", reps * N / aos / 1e6);
+	printf("mat4_transform_points_soa: %.1f Mpoints/s (%s)\n",
+		   reps * N / soa_s / 1e6, isa_name(isa_current()));
+}
+
 static void run_benchmarks(void)
 {
 	printf("\n=== Running benchmarks (vector transformations) ===\n");
@@ -358,6 +502,8 @@ static void run_benchmarks(void)
 	bench_mat4_transform_vector();
 	bench_mat4_transform_normal();
 	bench_mat4_transform_normal2();
+	isa_select(ISA_AUTO);
+	bench_mat4_transform_batch();
 }
 
 #endif /* BENCHMARK */
@@ -377,6 +523,8 @@ void test_mat4_transform()
 	test_mat4_transform_vector();
 	test_mat4_transform_normal();
 	test_mat4_transform_edge_cases();
+	test_mat4_transform_batch_aos();
+	test_mat4_transform_batch_soa();
 	printf("\n");
 #endif
 }
\ No newline at end of file
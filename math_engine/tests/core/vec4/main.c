@@ -0,0 +1,12 @@
+#include "core/test.h"
+
+int main(void)
+{
+	test_vec4();
+#ifdef BENCHMARK
+	printf("✓ ALL VEC4 BECNHMARKS COMPLETE!\n");
+#else
+	printf("✓ ALL VEC4 TESTS PASSED!\n");
+#endif
+	return 0;
+}
@@ -0,0 +1,233 @@
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <assert.h>
+#include "core/vec4.h"
+#include "core/constants.h"
+#include "core/test.h"
+
+static bool vec3_same(t_vec3 a, t_vec3 b)
+{
+	return (a.x == b.x && a.y == b.y && a.z == b.z);
+}
+
+// ============================================
+// UNIT TESTS - conversions
+// ============================================
+
+static void test_vec4_convert(void)
+{
+	t_vec3 v[2] = {{1.0f, -2.0f, 3.5f}, {4.0f, 5.0f, 6.0f}};
+	float f[4] __attribute__((aligned(16)));
+
+	// load3 reads exactly one t_vec3, w = 0
+	_mm_store_ps(f, vec4_load3(&v[0]));
+	assert(f[0] == 1.0f && f[1] == -2.0f && f[2] == 3.5f && f[3] == 0.0f);
+	_mm_store_ps(f, vec4_from_vec3(v[1], 1.0f));
+	assert(f[0] == 4.0f && f[1] == 5.0f && f[2] == 6.0f && f[3] == 1.0f);
+
+	// Round trip
+	assert(vec3_same(vec4_to_vec3(vec4_load3(&v[1])), v[1]));
+	assert(vec3_same(vec4_to_vec3(vec4_from_vec3(v[0], 1.0f)), v[0]));
+
+	printf("✓ ");
+}
+
+// ============================================
+// UNIT TESTS - same results as vec3
+// ============================================
+
+static void test_vec4_matches_vec3(void)
+{
+	for (int i = 0; i < TEST_ITERATIONS; i++)
+	{
+		t_vec3 a = random_vec3(-100.0f, 100.0f);
+		t_vec3 b = random_vec3(-100.0f, 100.0f);
+		t_vec4 va = vec4_from_vec3(a, 1.0f);
+		t_vec4 vb = vec4_from_vec3(b, 1.0f);
+
+		// Exact: same operations in the same order
+		assert(vec4_dot(va, vb) == vec3_dot(a, b));
+		assert(vec3_same(vec4_to_vec3(vec4_cross(va, vb)), vec3_cross(a, b)));
+		assert(vec3_same(vec4_to_vec3(vec4_add(va, vb)), vec3_add(a, b)));
+		assert(vec3_same(vec4_to_vec3(vec4_sub(va, vb)), vec3_sub(a, b)));
+		assert(vec3_same(vec4_to_vec3(vec4_scale(va, 0.5f)),
+			vec3_scale(a, 0.5f)));
+		assert(vec3_same(vec4_to_vec3(vec4_min(va, vb)), vec3_min_comp(a, b)));
+		assert(vec3_same(vec4_to_vec3(vec4_max(va, vb)), vec3_max_comp(a, b)));
+		assert(vec4_hmin3(va) == vec3_min(a));
+		assert(vec4_hmax3(va) == vec3_max(a));
+		assert(vec4_length(va) == vec3_length(a));
+	}
+	printf("✓ ");
+}
+
+// ============================================
+// UNIT TESTS - normalize (rsqrt + Newton)
+// ============================================
+
+static void test_vec4_normalize(void)
+{
+	t_vec3 v = vec3_new(3.0f, 4.0f, 0.0f);
+	t_vec3 n = vec4_to_vec3(vec4_normalize(vec4_from_vec3(v, 0.0f)));
+	assert(vec3_equal_eps(n, vec3_new(0.6f, 0.8f, 0.0f), 1e-6f));
+
+	for (int i = 0; i < TEST_ITERATIONS; i++)
+	{
+		v = random_vec3(-1000.0f, 1000.0f);
+		if (vec3_length_sq(v) < 1e-6f)
+			continue;
+		n = vec4_to_vec3(vec4_normalize(vec4_from_vec3(v, 0.0f)));
+		// One Newton step: a few ulps from the exact version
+		assert(vec3_equal_eps(n, vec3_normalize(v), 1e-6f));
+		assert(float_equal(vec3_length(n), 1.0f, 1e-6f));
+	}
+	// w = 0 stays 0
+	float f[4] __attribute__((aligned(16)));
+	_mm_store_ps(f, vec4_normalize(vec4_from_vec3(v, 0.0f)));
+	assert(f[3] == 0.0f);
+
+	printf("✓ ");
+}
+
+// ============================================
+// UNIT TESTS - mat4 transforms
+// ============================================
+
+static void test_vec4_transform(void)
+{
+	t_mat4 m = mat4_mul(mat4_rotation_axis(vec3_normalize(
+		vec3_new(1.0f, 2.0f, 3.0f)), 0.7f),
+		mat4_translation(vec3_new(5.0f, -1.0f, 2.0f)));
+	m = mat4_mul(m, mat4_scaling(vec3_new(2.0f, 0.5f, 3.0f)));
+
+	for (int i = 0; i < TEST_ITERATIONS; i++)
+	{
+		t_vec3 p = random_vec3(-100.0f, 100.0f);
+		t_vec4 v = vec4_from_vec3(p, 1.0f);
+
+		assert(vec3_equal_eps(vec4_to_vec3(mat4_transform_point4(&m, v)),
+			mat4_transform_point(m, p), 1e-4f));
+		assert(vec3_equal_eps(vec4_to_vec3(mat4_transform_vector4(&m, v)),
+			mat4_transform_vector(m, p), 1e-4f));
+		assert(vec3_equal_eps(vec4_to_vec3(mat4_transform_normal4(&m, v)),
+			mat4_transform_normal2(m, p), 1e-4f));
+	}
+	// An affine matrix keeps w: 1 for points, 0 for vectors
+	float f[4] __attribute__((aligned(16)));
+	_mm_store_ps(f, mat4_transform_point4(&m, vec4_from_vec3(vec3_one(), 1.0f)));
+	assert(f[3] == 1.0f);
+	_mm_store_ps(f, mat4_transform_vector4(&m, vec4_from_vec3(vec3_one(), 0.0f)));
+	assert(f[3] == 0.0f);
+
+	printf("✓ ");
+}
+
+// ============================================
+// BENCHMARKS
+// ============================================
+
+#ifdef BENCHMARK
+
+#include <time.h>
+
+#define BENCH_N 4096
+
+// keeps the compiler from folding the rounds into one
+#define BENCH_KEEP(p) __asm__ __volatile__("" : : "r"(p) : "memory")
+
+static void bench_vec4_normalize(void)
+{
+	static t_vec3 in[BENCH_N];
+	static t_vec3 out[BENCH_N];
+	struct timespec t1, t2;
+	int rounds = TEST_ITERATIONS / BENCH_N;
+
+	for (int i = 0; i < BENCH_N; i++)
+		in[i] = random_vec3(-100.0f, 100.0f);
+
+	clock_gettime(CLOCK_MONOTONIC, &t1);
+	for (int r = 0; r < rounds; r++)
+	{
+		for (int i = 0; i < BENCH_N; i++)
+			out[i] = vec3_normalize(in[i]);
+		BENCH_KEEP(out);
+	}
+	clock_gettime(CLOCK_MONOTONIC, &t2);
+	double sec3 = time_diff_sec(t1, t2);
+
+	clock_gettime(CLOCK_MONOTONIC, &t1);
+	for (int r = 0; r < rounds; r++)
+	{
+		for (int i = 0; i < BENCH_N; i++)
+			out[i] = vec4_to_vec3(vec4_normalize(vec4_load3(&in[i])));
+		BENCH_KEEP(out);
+	}
+	clock_gettime(CLOCK_MONOTONIC, &t2);
+	double sec4 = time_diff_sec(t1, t2);
+
+	printf("normalize: vec3 %.1f Mops/s, vec4 %.1f Mops/s\n",
+		rounds * (double)BENCH_N / sec3 / 1e6,
+		rounds * (double)BENCH_N / sec4 / 1e6);
+	(void)out;
+}
+
+static void bench_vec4_transform(void)
+{
+	static t_vec3 in[BENCH_N];
+	static t_vec3 out[BENCH_N];
+	struct timespec t1, t2;
+	int rounds = TEST_ITERATIONS / BENCH_N;
+	t_mat4 m = mat4_rotation_axis(vec3_normalize(vec3_one()), 0.5f);
+
+	for (int i = 0; i < BENCH_N; i++)
+		in[i] = random_vec3(-100.0f, 100.0f);
+
+	clock_gettime(CLOCK_MONOTONIC, &t1);
+	for (int r = 0; r < rounds; r++)
+	{
+		for (int i = 0; i < BENCH_N; i++)
+			out[i] = mat4_transform_point(m, in[i]);
+		BENCH_KEEP(out);
+	}
+	clock_gettime(CLOCK_MONOTONIC, &t2);
+	double sec3 = time_diff_sec(t1, t2);
+
+	clock_gettime(CLOCK_MONOTONIC, &t1);
+	for (int r = 0; r < rounds; r++)
+	{
+		for (int i = 0; i < BENCH_N; i++)
+			out[i] = vec4_to_vec3(mat4_transform_point4(&m,
+				vec4_load3(&in[i])));
+		BENCH_KEEP(out);
+	}
+	clock_gettime(CLOCK_MONOTONIC, &t2);
+	double sec4 = time_diff_sec(t1, t2);
+
+	printf("transform_point: mat4 %.1f Mops/s, vec4 %.1f Mops/s\n",
+		rounds * (double)BENCH_N / sec3 / 1e6,
+		rounds * (double)BENCH_N / sec4 / 1e6);
+	(void)out;
+}
+
+#endif // BENCHMARK
+
+// ============================================
+// MAIN TEST RUNNER
+// ============================================
+
+void test_vec4(void)
+{
+#ifdef BENCHMARK
+	printf("\n=== Running benchmarks (vec4) ===\n");
+	bench_vec4_normalize();
+	bench_vec4_transform();
+#else
+	srand(42);
+	test_vec4_convert();
+	test_vec4_matches_vec3();
+	test_vec4_normalize();
+	test_vec4_transform();
+#endif
+}
@@ -0,0 +1,12 @@
+#include "core/test.h"
+
+int main(void)
+{
+	test_parse_float();
+#ifdef BENCHMARK
+	printf("✓ ALL PARSE BECNHMARKS COMPLETE!\n");
+#else
+	printf("✓ ALL PARSE TESTS PASSED!\n");
+#endif
+	return 0;
+}
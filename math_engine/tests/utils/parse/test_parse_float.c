@@ -0,0 +1,348 @@
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <float.h>
+#include <assert.h>
+#include <stdint.h>
+#include "utils/parse_float.h"
+#include "core/test.h"
+
+// strtod/strtof are the reference: same bits, same end of number
+static void check_double(const char *s)
+{
+	char *ref_end;
+	double ref = strtod(s, &ref_end);
+	double got;
+	const char *end = parse_double(s, &got);
+	if (!end || end != ref_end || memcmp(&got, &ref, sizeof(got)))
+	{
+		printf("parse_double(\"%s\") = %.17g, strtod = %.17g\n", s, got, ref);
+		assert(0);
+	}
+}
+
+static void check_float(const char *s)
+{
+	char *ref_end;
+	float ref = strtof(s, &ref_end);
+	float got;
+	const char *end = parse_float(s, &got);
+	if (!end || end != ref_end || memcmp(&got, &ref, sizeof(got)))
+	{
+		printf("parse_float(\"%s\") = %.9g, strtof = %.9g\n", s, got, ref);
+		assert(0);
+	}
+}
+
+static void check_both(const char *s)
+{
+	check_double(s);
+	check_float(s);
+}
+
+static uint64_t rand64(void)
+{
+	return ((uint64_t)rand() << 62) ^ ((uint64_t)rand() << 31) ^ rand();
+}
+
+// ============================================
+// UNIT TESTS - syntax
+// ============================================
+
+static void test_parse_syntax(void)
+{
+	double d;
+	float f;
+
+	// No digits in the mantissa
+	const char *bad[] = {"", ".", "-", "+", "+.", "-.e5", "e5", "abc",
+		" 1", "inf", "nan", ",1"};
+	for (size_t i = 0; i < sizeof(bad) / sizeof(*bad); i++)
+	{
+		assert(parse_double(bad[i], &d) == NULL);
+		assert(parse_float(bad[i], &f) == NULL);
+	}
+
+	// Stops where strtod stops
+	const char *s = "1e";
+	assert(parse_double(s, &d) == s + 1 && d == 1.0);
+	s = "2.5e+,";
+	assert(parse_double(s, &d) == s + 3 && d == 2.5);
+	s = "5.,0";
+	assert(parse_float(s, &f) == s + 2 && f == 5.0f);
+	s = ".5x";
+	assert(parse_float(s, &f) == s + 2 && f == 0.5f);
+	s = "-0,1";
+	assert(parse_double(s, &d) == s + 2 && d == 0.0 && signbit(d));
+	s = "1E3 ";
+	assert(parse_float(s, &f) == s + 3 && f == 1000.0f);
+
+	printf("✓ ");
+}
+
+// ============================================
+// UNIT TESTS - edge values
+// ============================================
+
+static void test_parse_edges(void)
+{
+	const char *cases[] = {
+		"0", "-0", "+0", "0.0", "00000.00000e99999", "1", "-1", "0.1",
+		"3.14159", "255", "0.5", "-0.3333", "1e22", "1e23", "1e-22",
+		"9007199254740992", "9007199254740993", "9007199254740995",
+		"16777216", "16777217", "16777219",
+		"1.7976931348623157e308", "1.7976931348623158e308",
+		"1.7976931348623159e308", "1e309", "-1e400", "1e99999999999",
+		"2.2250738585072011e-308", "2.2250738585072014e-308",
+		"4.9406564584124654e-324", "2.4703282292062327e-324",
+		"2.4703282292062328e-324", "1e-400", "1e-99999999999",
+		"3.4028234663852886e38", "3.4028235677973366e38",
+		"3.4028236e38", "1.17549435e-38", "1.4012984643e-45",
+		"7.006492321624085e-46", "7.006492321624086e-46", "1e-46",
+		"0.1000000000000000055511151231257827021181583404541015625",
+		"123456789012345678901234567890",
+		"1234567890123456789.0000000000000000001",
+		"9999999999999999999", "10000000000000000000",
+		"18446744073709551615", "18446744073709551616",
+		"0.00000000000000000000000000000000000000000000001",
+		"2.0000000000000000000000000000001",
+		"1.00000005960464477539062499",
+		"1.00000005960464477539062500",
+		"1.00000005960464477539062501",
+		"1.00000000000000011102230246251565404236316680908203125",
+		"1.00000000000000011102230246251565404236316680908203124",
+		"1.00000000000000011102230246251565404236316680908203126",
+	};
+	for (size_t i = 0; i < sizeof(cases) / sizeof(*cases); i++)
+		check_both(cases[i]);
+
+	// Every exponent the table covers
+	char buf[64];
+	for (int e = -360; e <= 330; e++)
+	{
+		snprintf(buf, sizeof(buf), "1e%d", e);
+		check_both(buf);
+		snprintf(buf, sizeof(buf), "7.3e%d", e);
+		check_both(buf);
+		snprintf(buf, sizeof(buf), "9999999999999999999e%d", e);
+		check_both(buf);
+	}
+
+	printf("✓ ");
+}
+
+// ============================================
+// UNIT TESTS - random values
+// ============================================
+
+static void test_parse_random_doubles(void)
+{
+	// Random bit patterns, printed at every precision
+	char buf[64];
+	for (int i = 0; i < TEST_ITERATIONS * 10; i++)
+	{
+		uint64_t bits = rand64();
+		double x;
+		memcpy(&x, &bits, sizeof(x));
+		if (!isfinite(x))
+			continue;
+		snprintf(buf, sizeof(buf), "%.*g", 1 + i % 17, x);
+		check_both(buf);
+	}
+
+	// Scene style decimals
+	for (int i = 0; i < TEST_ITERATIONS * 10; i++)
+	{
+		snprintf(buf, sizeof(buf), "%.*f", i % 7,
+			random_float(-1000.0f, 1000.0f));
+		check_both(buf);
+	}
+
+	printf("✓ ");
+}
+
+static void test_parse_random_digits(void)
+{
+	// Up to 40 digits anywhere around the point, any exponent
+	char buf[96];
+	for (int i = 0; i < TEST_ITERATIONS * 10; i++)
+	{
+		int n = 1 + rand() % 40;
+		int dot = rand() % (n + 1);
+		int len = 0;
+		for (int k = 0; k < n; k++)
+		{
+			if (k == dot)
+				buf[len++] = '.';
+			buf[len++] = (char)('0' + rand() % 10);
+		}
+		snprintf(buf + len, sizeof(buf) - len, "e%d", rand() % 700 - 360);
+		check_both(buf);
+	}
+
+	printf("✓ ");
+}
+
+// Exact decimal of the point halfway between two neighbours, and the
+// same nudged one digit either way: the hardest inputs to round
+static void test_parse_halfway(void)
+{
+	char buf[1200];
+	for (int i = 0; i < TEST_ITERATIONS; i++)
+	{
+		uint64_t bits = rand64() & 0x7FEFFFFFFFFFFFFFULL;
+		double x;
+		memcpy(&x, &bits, sizeof(x));
+		long double mid = ((long double)x + nextafter(x, INFINITY)) / 2;
+		int len = snprintf(buf, sizeof(buf), "%.1100Lg", mid);
+		assert(len < (int)sizeof(buf));
+		check_double(buf);
+
+		float y = (float)x;
+		if (!isfinite(y) || y == 0.0f)
+			y = random_float(-1e6f, 1e6f);
+		double midf = ((double)y + nextafterf(y, INFINITY)) / 2;
+		snprintf(buf, sizeof(buf), "%.200g", midf);
+		check_float(buf);
+
+		// Nudge the last digit of the float midpoint
+		len = (int)strcspn(buf, "e");
+		while (len > 0 && (buf[len - 1] < '0' || buf[len - 1] > '8'))
+			len--;
+		if (len > 0)
+		{
+			buf[len - 1]++;
+			check_float(buf);
+		}
+	}
+
+	printf("✓ ");
+}
+
+// ============================================
+// BENCHMARKS
+// ============================================
+
+#ifdef BENCHMARK
+
+#include <time.h>
+
+#define BENCH_NUMBERS 100000
+
+typedef struct s_bench_text
+{
+	char	*buf;
+	size_t	size;
+}	t_bench_text;
+
+// numbers separated by single spaces, as in a scene file
+static t_bench_text bench_text(int scene_style)
+{
+	t_bench_text t = {malloc(BENCH_NUMBERS * 32), 0};
+	for (int i = 0; i < BENCH_NUMBERS; i++)
+	{
+		if (scene_style)
+			t.size += sprintf(t.buf + t.size, "%.*f ", i % 4,
+				random_float(-100.0f, 100.0f));
+		else
+			t.size += sprintf(t.buf + t.size, "%.17g ",
+				(double)random_float(-1.0f, 1.0f) * pow(10, rand() % 40 - 20));
+	}
+	return t;
+}
+
+static void bench_report(const char *name, t_bench_text t, int rounds,
+	struct timespec t1, struct timespec t2)
+{
+	double sec = time_diff_sec(t1, t2);
+	printf("%-14s %7.1f Mnumbers/s %7.1f MB/s\n", name,
+		rounds * (double)BENCH_NUMBERS / sec / 1e6,
+		rounds * (double)t.size / sec / 1e6);
+}
+
+static void benchmark_parse(const char *label, int scene_style)
+{
+	t_bench_text t = bench_text(scene_style);
+	struct timespec t1, t2;
+	int rounds = TEST_ITERATIONS / BENCH_NUMBERS;
+	volatile double dsink = 0;
+	volatile float fsink = 0;
+
+	printf("-- %s --\n", label);
+	clock_gettime(CLOCK_MONOTONIC, &t1);
+	for (int r = 0; r < rounds; r++)
+	{
+		char *p = t.buf;
+		for (int i = 0; i < BENCH_NUMBERS; i++)
+			dsink += strtod(p, &p);
+	}
+	clock_gettime(CLOCK_MONOTONIC, &t2);
+	bench_report("strtod", t, rounds, t1, t2);
+
+	clock_gettime(CLOCK_MONOTONIC, &t1);
+	for (int r = 0; r < rounds; r++)
+	{
+		const char *p = t.buf;
+		double d;
+		for (int i = 0; i < BENCH_NUMBERS; i++)
+		{
+			p = parse_double(p, &d) + 1;
+			dsink += d;
+		}
+	}
+	clock_gettime(CLOCK_MONOTONIC, &t2);
+	bench_report("parse_double", t, rounds, t1, t2);
+
+	clock_gettime(CLOCK_MONOTONIC, &t1);
+	for (int r = 0; r < rounds; r++)
+	{
+		char *p = t.buf;
+		for (int i = 0; i < BENCH_NUMBERS; i++)
+			fsink += strtof(p, &p);
+	}
+	clock_gettime(CLOCK_MONOTONIC, &t2);
+	bench_report("strtof", t, rounds, t1, t2);
+
+	clock_gettime(CLOCK_MONOTONIC, &t1);
+	for (int r = 0; r < rounds; r++)
+	{
+		const char *p = t.buf;
+		float f;
+		for (int i = 0; i < BENCH_NUMBERS; i++)
+		{
+			p = parse_float(p, &f) + 1;
+			fsink += f;
+		}
+	}
+	clock_gettime(CLOCK_MONOTONIC, &t2);
+	bench_report("parse_float", t, rounds, t1, t2);
+	free(t.buf);
+	(void)dsink;
+	(void)fsink;
+}
+
+#endif // BENCHMARK
+
+// ============================================
+// MAIN TEST RUNNER
+// ============================================
+
+void test_parse_float(void)
+{
+#ifdef BENCHMARK
+	printf("\n=== Running benchmarks (number parsing) ===\n");
+	srand(42);
+	benchmark_parse("scene decimals", 1);
+	benchmark_parse("17 digit doubles", 0);
+#else
+	srand(42);
+
+	test_parse_syntax();
+	test_parse_edges();
+	test_parse_random_doubles();
+	test_parse_random_digits();
+	test_parse_halfway();
+#endif
+}
@@ -6,7 +6,7 @@
 /*   By: sabruma <sabruma@student.42firenze.it>     +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2026/01/17 10:09:29 by gmu               #+#    #+#             */
-/*   Updated: 2026/03/31 23:51:47 by gmu              ###   ########.fr       */
+/*   Updated: 2026/10/18 00:03:42 by gmu              ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -16,16 +16,16 @@
 /*
  * Example mock of data array of t_element type:
  * t_element file_data = {
- * {id = "A", {brightness = 0.2, color = {255, 255, 255}}},
- * {id = "C", {viewpoint = {-50.0, 0.0, 20.0}, orientation = {0.0, 0.0, 1.0},
+ * {ELEM_AMBIENT, {brightness = 0.2, color = {255, 255, 255}}},
+ * {ELEM_CAMERA, {viewpoint = {-50.0, 0.0, 20.0}, orientation = {0.0, 0.0, 1.0},
 	fov = 80}},
- * {id = "L", {position = {-40.0, 50.0, 0.0}, brightness = 0.6, color = {10, 0,
-	255}}},
- * {id = "sp", {center = {0.0, 0.0, 20.6}, diameter = 12.6, color = {10, 0,
-	255}}},
- * {id = "pl", {point = {0.0, 0.0, -10.0}, normal = {0.0, 1.0, 0.0}, color = {0,
+ * {ELEM_LIGHT, {position = {-40.0, 50.0, 0.0}, brightness = 0.6, color = {10,
 	0, 255}}},
- * {id = "cy", {center = {50.0, 0.0, 20.6}, axis = {0.0, 0.0, 1.0},
+ * {ELEM_SPHERE, {center = {0.0, 0.0, 20.6}, diameter = 12.6, color = {10, 0,
+	255}}},
+ * {ELEM_PLANE, {point = {0.0, 0.0, -10.0}, normal = {0.0, 1.0, 0.0}, color = {
+	0, 0, 255}}},
+ * {ELEM_CYLINDER, {center = {50.0, 0.0, 20.6}, axis = {0.0, 0.0, 1.0},
 	diameter = 14.2, height = 21.42, color = {10, 0, 255}}}
  * }
  * ==> file contains:
@@ -37,12 +37,12 @@
  * cy 50.0,0.0,20.6 0.0,0.0,1.0 14.2 21.42 10,0,255
  *
  * Note: since t_element is a raw tagged union, each t_element contains always:
- * id AND ONE of the union's structs (once chosen).
+ * its type AND ONE of the union's structs (once chosen).
  * Once the t_element is initialized,
 	the union's struct can be read as another (but you get garbage data)
  * and modifying the struct if it's not the right type leads to data corruption,
 	flagged by cc (maybe).
- * sizeof(t_element) returns 8 + sizeof(t_cylinder) cause it's the largest one.
+ * sizeof(t_element) returns 4 + sizeof(t_cylinder) cause it's the largest one.
  */
 
 // int	check_a_ok(char *s);
@@ -56,24 +56,34 @@
 // printf("[come e' andata: %d]\n", check_a_ok("A 0.2 255,255,255"));
 
 #include "utils/math_constants.h"
+#include "minirt_scene.h"
 
+// the scene comes from text or from a .rtb, then it is exported,
+// benchmarked, written to a file or shown, in this order of priority
 int	main(int argc, char **argv)
 {
-	t_element	*data_file;
+	t_options	opts;
+	t_math		*math;
+	t_stats		stats;
+	int			err;
 
-	if (argc > 2)
-	{
-		printf("Invalid argument count: %d", argc);
+	if (!parse_options(argc, argv, &opts))
 		return (1);
-	}
-	data_file = parse_input(argc, argv);
-	if (!data_file)
-	{
-		printf("Parsing error: invalid file data");
+	stats = (t_stats){0};
+	math = load_scene(&opts, &stats);
+	if (!math)
 		return (1);
-	}
-	printf("Parsing successful!\n");
-	mlx_init_windows_minirt(data_file);
-	free(data_file);
-	return (0);
+	err = 0;
+	if (opts.export_binary)
+		err = rtb_export(math, opts.export_binary);
+	if (!err && opts.bench_runs)
+		err = render_bench(math, &opts, &stats);
+	else if (!err && opts.output)
+		err = render_to_file(math, &opts, &stats);
+	else if (!err && !opts.export_binary)
+		mlx_init_windows_minirt(math, &opts, &stats);
+	if (!err && (opts.stats || opts.stats_json))
+		err = stats_report(&stats, &opts);
+	destroy_math(math);
+	return (err);
 }
@@ -6,7 +6,7 @@
 /*   By: sabruma <sabruma@student.42.fr>            +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2026/03/31 15:16:23 by gmu               #+#    #+#             */
-/*   Updated: 2026/03/31 23:53:15 by gmu              ###   ########.fr       */
+/*   Updated: 2026/10/18 00:03:42 by gmu              ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -22,7 +22,6 @@
 // funzione per liberare tutto
 int	free_all_minirt(t_mlx_minirt *mlx)
 {
-	free(mlx->data_file);
 	mlx_destroy_image(mlx->mlx, mlx->img);
 	mlx_destroy_window(mlx->mlx, mlx->win);
 	mlx_destroy_display(mlx->mlx);
@@ -39,49 +38,30 @@ int	key_hook_minirt(int keycode, t_mlx_minirt *mlx)
 	return (0);
 }
 
-// uncomment for benchmarking rendering
-// #include <time.h>
-// #define N_RUNS 5
-
-// double time_diff_sec(struct timespec start, struct timespec end)
-// {
-// 	return (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) * 1e-9;
-// }
-
 // minilibx e altre cose
 // cose assolutamente obbligatorie per mlx
-void	mlx_init_windows_minirt(t_element *data_file)
+// mlx_loop non ritorna: le stats vanno stampate prima
+void	mlx_init_windows_minirt(t_math *math, t_options *opts, t_stats *stats)
 {
 	t_mlx_minirt	mlx;
+	t_framebuffer	fb;
 
-	mlx.math = init_math(data_file);
-	if (!mlx.math)
-	{
-		printf("Malloc error: failed to initialize math engine");
-		free(data_file);
-		return ;
-	}
-	mlx.data_file = data_file;
+	mlx.math = math;
+	mlx.opts = opts;
 	mlx.mlx = mlx_init();
-	mlx.win = mlx_new_window(mlx.mlx, IMG_WIDTH, IMG_HEIGHT, "MiniRT window");
-	mlx.img = mlx_new_image(mlx.mlx, IMG_WIDTH, IMG_HEIGHT);
+	mlx.win = mlx_new_window(mlx.mlx, opts->width, opts->height,
+			"MiniRT window");
+	mlx.img = mlx_new_image(mlx.mlx, opts->width, opts->height);
 	mlx.addr = mlx_get_data_addr(mlx.img, &mlx.bpp, &mlx.line_len, &mlx.endian);
+	fb = (t_framebuffer){.pixels = (uint32_t *)mlx.addr, .width = opts->width,
+		.height = opts->height, .stride = mlx.line_len / (mlx.bpp / 8)};
 	printf("RENDERING\n");
-	render_minirt(&mlx, mlx.math);
+	render_minirt(&fb, mlx.math, opts, stats);
 	printf("RENDERED\n");
+	stats_report(stats, opts);
 	mlx_put_image_to_window(mlx.mlx, mlx.win, mlx.img, 0, 0);
 	mlx_hook(mlx.win, 17, 1 << 17, free_all_minirt, &mlx);
 	mlx_key_hook(mlx.win, key_hook_minirt, &mlx);
 	mlx_loop(mlx.mlx);
 }
 
-// ===== BENCH RENDERING =====
-// double total_time = 0.0;
-// for (int run = 0; run < N_RUNS; run++) {
-// 	struct timespec t1, t2;
-// 	clock_gettime(CLOCK_MONOTONIC, &t1);
-// 	render_minirt(&mlx, mlx.math);
-// 	clock_gettime(CLOCK_MONOTONIC, &t2);
-// 	total_time += time_diff_sec(t1, t2) * 1000;
-// }
-// printf("Average over %d runs: %.2f ms\n", N_RUNS, total_time / N_RUNS);
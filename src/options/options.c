@@ -0,0 +1,112 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   options.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: gmu <marvin@42.fr>                         +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 22:22:06 by gmu               #+#    #+#             */
+/*   Updated: 2026/10/18 00:28:25 by gmu              ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt_options.h"
+#include "libft.h"
+#include <stdio.h>
+#include <unistd.h>
+
+#define MSG_USAGE "Usage: %s [options] <scene_file.rt|scene_file.rtb>\n"
+#define MSG_OPTIONS "  --threads N  --tile N  --size WxH\n" \
+	"  --output out.ppm|out.pfm  --strip N\n" \
+	"  --bench N  --json out.json  --export-binary out.rtb\n" \
+	"  --stats  --stats-json out.json  --isa auto|sse2|avx2|avx512\n"
+
+// threads default to the online cpus
+static t_options	default_options(void)
+{
+	long	cpus;
+
+	cpus = sysconf(_SC_NPROCESSORS_ONLN);
+	if (cpus < 1)
+		cpus = 1;
+	if (cpus > MAX_THREADS)
+		cpus = MAX_THREADS;
+	return ((t_options){.threads = (int)cpus, .tile_size = TILE_SIZE,
+		.width = IMG_WIDTH, .height = IMG_HEIGHT});
+}
+
+// the extension decides the format, anything else is refused.
+// --export-binary only takes .rtb, so the file is recognized when loaded
+static bool	parse_output(const char *flag, const char *s, t_options *opts)
+{
+	size_t	len;
+
+	if (!s)
+		return (false);
+	len = ft_strlen(s);
+	if (ft_strcmp(flag, "--export-binary") == 0)
+	{
+		opts->export_binary = (char *)s;
+		return (len > 4 && ft_strcmp(s + len - 4, ".rtb") == 0);
+	}
+	opts->format = IMG_NONE;
+	if (len > 4 && ft_strcmp(s + len - 4, ".ppm") == 0)
+		opts->format = IMG_PPM;
+	else if (len > 4 && ft_strcmp(s + len - 4, ".pfm") == 0)
+		opts->format = IMG_PFM;
+	opts->output = (char *)s;
+	return (opts->format != IMG_NONE);
+}
+
+// returns how many argv entries the switch consumed, 0 if it is invalid
+static int	parse_switch(char **argv, int i, t_options *opts)
+{
+	int	used;
+
+	used = parse_number(argv, i, opts);
+	if (used >= 0)
+		return (used);
+	if (ft_strcmp(argv[i], "--output") == 0
+		|| ft_strcmp(argv[i], "--export-binary") == 0)
+		return (2 * parse_output(argv[i], argv[i + 1], opts));
+	if (ft_strcmp(argv[i], "--stats") == 0)
+		opts->stats = true;
+	else if (ft_strcmp(argv[i], "--json") == 0 && argv[i + 1])
+		opts->json = argv[i + 1];
+	else if (ft_strcmp(argv[i], "--stats-json") == 0 && argv[i + 1])
+		opts->stats_json = argv[i + 1];
+	else if (ft_strcmp(argv[i], "--isa") == 0 && argv[i + 1])
+		return (2 * isa_parse(argv[i + 1], &opts->isa));
+	else
+		return (0);
+	return (1 + (ft_strcmp(argv[i], "--stats") != 0));
+}
+
+bool	parse_options(int argc, char **argv, t_options *opts)
+{
+	int	i;
+	int	used;
+
+	*opts = default_options();
+	i = 1;
+	while (i < argc)
+	{
+		used = 1;
+		if (ft_strncmp(argv[i], "--", 2) == 0)
+			used = parse_switch(argv, i, opts);
+		else if (!opts->scene)
+			opts->scene = argv[i];
+		else
+			used = 0;
+		if (!used)
+			return (printf("Invalid argument: %s\n" MSG_USAGE MSG_OPTIONS,
+					argv[i], argv[0]), false);
+		i += used;
+	}
+	if (!opts->scene)
+		return (printf(MSG_USAGE MSG_OPTIONS, argv[0]), false);
+	if (isa_select(opts->isa))
+		return (printf("Error: this cpu can't run %s kernels\n",
+				isa_name(opts->isa)), false);
+	return (true);
+}
@@ -0,0 +1,75 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   options_values.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: gmu <marvin@42.fr>                         +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:38:37 by gmu               #+#    #+#             */
+/*   Updated: 2026/10/18 01:21:08 by gmu              ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt_options.h"
+#include "libft.h"
+
+// strictly positive decimal integer, no sign and no trailing garbage
+bool	parse_count(const char *s, int *out)
+{
+	long	value;
+
+	if (!s || !*s)
+		return (false);
+	value = 0;
+	while (ft_isdigit(*s) && value <= INT_MAX)
+		value = value * 10 + (*s++ - '0');
+	if (*s || value <= 0 || value > INT_MAX)
+		return (false);
+	*out = (int)value;
+	return (true);
+}
+
+// WxH, both sides at most MAX_IMG_SIDE
+static bool	parse_size(const char *s, t_options *opts)
+{
+	char	buf[32];
+	char	*x;
+
+	if (!s || ft_strlen(s) >= sizeof(buf))
+		return (false);
+	ft_strlcpy(buf, s, sizeof(buf));
+	x = ft_strchr(buf, 'x');
+	if (!x)
+		return (false);
+	*x = '\0';
+	return (parse_count(buf, &opts->width) && parse_count(x + 1, &opts->height)
+		&& opts->width <= MAX_IMG_SIDE && opts->height <= MAX_IMG_SIDE);
+}
+
+// the switches that take a number, -1 when argv[i] isn't one of them
+int	parse_number(char **argv, int i, t_options *opts)
+{
+	if (ft_strcmp(argv[i], "--threads") == 0)
+	{
+		if (!parse_count(argv[i + 1], &opts->threads))
+			return (0);
+		if (opts->threads > MAX_THREADS)
+			opts->threads = MAX_THREADS;
+		return (2);
+	}
+	if (ft_strcmp(argv[i], "--tile") == 0)
+	{
+		if (!parse_count(argv[i + 1], &opts->tile_size))
+			return (0);
+		if (opts->tile_size > MAX_IMG_SIDE)
+			opts->tile_size = MAX_IMG_SIDE;
+		return (2);
+	}
+	if (ft_strcmp(argv[i], "--bench") == 0)
+		return (2 * parse_count(argv[i + 1], &opts->bench_runs));
+	if (ft_strcmp(argv[i], "--strip") == 0)
+		return (2 * parse_count(argv[i + 1], &opts->strip_rows));
+	if (ft_strcmp(argv[i], "--size") == 0)
+		return (2 * parse_size(argv[i + 1], opts));
+	return (-1);
+}
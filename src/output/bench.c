@@ -0,0 +1,101 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: sabruma <sabruma@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:00:55 by sabruma           #+#    #+#             */
+/*   Updated: 2026/10/18 00:03:42 by sabruma          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt_output.h"
+#include "minirt_renderer.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+double	now_ms(void)
+{
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec * 1000.0 + ts.tv_nsec / 1e6);
+}
+
+// a handful of frames, insertion sort is plenty
+static void	sort_times(double *t, int n)
+{
+	double	key;
+	int		i;
+	int		j;
+
+	i = 0;
+	while (++i < n)
+	{
+		key = t[i];
+		j = i - 1;
+		while (j >= 0 && t[j] > key)
+		{
+			t[j + 1] = t[j];
+			j--;
+		}
+		t[j + 1] = key;
+	}
+}
+
+// one untimed frame first so page faults and cold caches stay out of
+// the numbers, then every frame is timed on its own
+static void	bench_frames(t_bench *b, t_framebuffer *fb, t_math *math,
+				const t_options *opts)
+{
+	double	start;
+	int		i;
+
+	render_minirt(fb, math, opts, NULL);
+	i = 0;
+	while (i < b->runs)
+	{
+		start = now_ms();
+		b->rays = render_minirt(fb, math, opts, b->stats);
+		b->frame_ms[i++] = now_ms() - start;
+	}
+	sort_times(b->frame_ms, b->runs);
+}
+
+static int	bench_fail(t_framebuffer *fb, t_bench *b)
+{
+	fb_destroy(fb);
+	free(b->frame_ms);
+	return (printf("Malloc error: failed to set up the benchmark\n"), 1);
+}
+
+// --bench: the loaded scene is rendered opts->bench_runs times in memory,
+// the last frame still goes to --output if one was given. setup is
+// how long loading and building the scene took
+int	render_bench(t_math *math, t_options *opts, t_stats *stats)
+{
+	t_framebuffer	fb;
+	t_bench			b;
+	int				err;
+
+	b = (t_bench){.scene = opts->scene, .runs = opts->bench_runs,
+		.threads = opts->threads, .width = opts->width, .height = opts->height,
+		.stats = stats, .setup_ms = stats->wall_ms[STAGE_LOAD]
+		+ stats->wall_ms[STAGE_BUILD]};
+	fb = (t_framebuffer){0};
+	b.frame_ms = malloc(b.runs * sizeof(double));
+	if (!b.frame_ms
+		|| fb_init(&fb, opts->width, opts->height, opts->format == IMG_PFM))
+		return (bench_fail(&fb, &b));
+	bench_frames(&b, &fb, math, opts);
+	err = bench_report(&b, opts);
+	stage_begin(stats, STAGE_WRITE);
+	if (opts->output && fb_write(&fb, opts))
+		err = 1;
+	stage_end(stats, STAGE_WRITE);
+	fb_destroy(&fb);
+	free(b.frame_ms);
+	return (err);
+}
@@ -0,0 +1,85 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_report.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: sabruma <sabruma@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:01:05 by sabruma           #+#    #+#             */
+/*   Updated: 2026/10/18 00:28:25 by sabruma          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt_output.h"
+#include <fcntl.h>
+#include <math.h>
+#include <stdio.h>
+#include <unistd.h>
+
+// nearest rank on the sorted frame times
+static double	percentile(const t_bench *b, double p)
+{
+	int	rank;
+
+	rank = (int)ceil(p * b->runs) - 1;
+	if (rank < 0)
+		rank = 0;
+	return (b->frame_ms[rank]);
+}
+
+static double	median(const t_bench *b)
+{
+	return ((b->frame_ms[(b->runs - 1) / 2] + b->frame_ms[b->runs / 2]) / 2);
+}
+
+// scene paths go in as json strings, only quotes and backslashes need it
+static void	json_string(int fd, const char *s)
+{
+	dprintf(fd, "\"");
+	while (*s)
+	{
+		if (*s == '"' || *s == '\\')
+			dprintf(fd, "\\");
+		dprintf(fd, "%c", *s++);
+	}
+	dprintf(fd, "\"");
+}
+
+// one object per run, Mrays/s is taken at the median frame
+static int	write_json(const t_bench *b, const char *path, double per_pixel)
+{
+	int	fd;
+
+	fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+	if (fd < 0)
+		return (printf("Output error: cannot write %s\n", path), 1);
+	dprintf(fd, "{\"scene\": ");
+	json_string(fd, b->scene);
+	dprintf(fd, ", \"width\": %d, \"height\": %d, \"threads\": %d, "
+		"\"isa\": \"%s\", \"runs\": %d, \"setup_ms\": %.3f, "
+		"\"min_ms\": %.3f, \"median_ms\": %.3f, \"p95_ms\": %.3f, "
+		"\"rays_per_frame\": %ld, \"rays_per_pixel\": %.4f, "
+		"\"mrays_per_s\": %.3f}\n", b->width, b->height, b->threads,
+		isa_name(isa_current()), b->runs, b->setup_ms, b->frame_ms[0],
+		median(b), percentile(b, 0.95), b->rays, per_pixel,
+		b->rays / (median(b) * 1000.0));
+	if (close(fd) < 0)
+		return (printf("Output error: cannot write %s\n", path), 1);
+	return (0);
+}
+
+int	bench_report(const t_bench *b, const t_options *opts)
+{
+	double	per_pixel;
+
+	per_pixel = (double)b->rays / ((long)b->width * b->height);
+	printf("bench %s: %d frames on %d threads (%s), setup %.2f ms\n"
+		"bench %s: min %.2f ms  median %.2f ms  p95 %.2f ms  "
+		"%.2f Mrays/s  %.2f rays/px\n", b->scene, b->runs, b->threads,
+		isa_name(isa_current()), b->setup_ms, b->scene, b->frame_ms[0],
+		median(b), percentile(b, 0.95), b->rays / (median(b) * 1000.0),
+		per_pixel);
+	if (opts->json)
+		return (write_json(b, opts->json, per_pixel));
+	return (0);
+}
@@ -0,0 +1,57 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   framebuffer.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: sabruma <sabruma@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 22:57:34 by sabruma           #+#    #+#             */
+/*   Updated: 2026/10/17 23:39:31 by sabruma          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt_output.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+// a plain frame in memory, hdr only when a float image is wanted
+int	fb_init(t_framebuffer *fb, int width, int height, bool hdr)
+{
+	*fb = (t_framebuffer){.width = width, .height = height, .stride = width};
+	fb->pixels = malloc((size_t)width * height * sizeof(uint32_t));
+	if (hdr)
+		fb->hdr = malloc((size_t)width * height * sizeof(t_vec3));
+	if (!fb->pixels || (hdr && !fb->hdr))
+		return (fb_destroy(fb), 1);
+	return (0);
+}
+
+void	fb_destroy(t_framebuffer *fb)
+{
+	free(fb->pixels);
+	free(fb->hdr);
+	*fb = (t_framebuffer){0};
+}
+
+// err says if something already went wrong, a failed close adds to it
+int	image_close(t_image_file *img, int err)
+{
+	if (img->fd >= 0 && close(img->fd) < 0)
+		err = 1;
+	free(img->buf);
+	if (err)
+		printf("Output error: cannot write %s\n", img->path);
+	*img = (t_image_file){.fd = -1};
+	return (err);
+}
+
+// the --output file in the format its extension asked for, as one strip
+int	fb_write(const t_framebuffer *fb, const t_options *opts)
+{
+	t_image_file	img;
+
+	if (image_open(&img, opts, fb->height))
+		return (1);
+	return (image_close(&img, image_write_strip(&img, fb)));
+}
@@ -0,0 +1,26 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   no_display.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: sabruma <sabruma@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 22:57:34 by sabruma           #+#    #+#             */
+/*   Updated: 2026/10/18 00:03:42 by sabruma          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt_output.h"
+#include "minirt_renderer.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+// stands in for the window in builds without minilibx (make headless)
+void	mlx_init_windows_minirt(t_math *math, t_options *opts, t_stats *stats)
+{
+	(void)opts;
+	(void)stats;
+	printf("Error: built without a display, use --output out.ppm\n");
+	destroy_math(math);
+	exit(1);
+}
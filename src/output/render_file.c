@@ -0,0 +1,77 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   render_file.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: sabruma <sabruma@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 22:57:34 by sabruma           #+#    #+#             */
+/*   Updated: 2026/10/18 00:03:42 by sabruma          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt_output.h"
+#include "minirt_renderer.h"
+#include <stdio.h>
+
+// --strip rows, or as many whole tiles of rows as STRIP_PIXELS allows:
+// memory stays the same however big --size gets
+static int	strip_rows(const t_options *opts)
+{
+	int	rows;
+
+	rows = opts->strip_rows;
+	if (!rows)
+	{
+		rows = STRIP_PIXELS / opts->width / opts->tile_size * opts->tile_size;
+		if (rows < opts->tile_size)
+			rows = opts->tile_size;
+	}
+	if (rows > opts->height)
+		rows = opts->height;
+	return (rows);
+}
+
+// each strip goes to the file before the next one is rendered over it
+static int	render_strips(t_framebuffer *fb, t_image_file *img, t_math *math,
+				t_stats *stats)
+{
+	const t_options	*opts;
+	int				rows;
+	int				err;
+
+	opts = img->opts;
+	rows = fb->height;
+	err = 0;
+	while (!err && fb->y0 < opts->height)
+	{
+		if (fb->y0 + rows > opts->height)
+			fb->height = opts->height - fb->y0;
+		render_minirt(fb, math, opts, stats);
+		stage_begin(stats, STAGE_WRITE);
+		err = image_write_strip(img, fb);
+		stage_end(stats, STAGE_WRITE);
+		fb->y0 += rows;
+	}
+	return (err);
+}
+
+// headless path: render strip by strip -> file.
+// no display is opened, so it runs where there is no X server
+int	render_to_file(t_math *math, t_options *opts, t_stats *stats)
+{
+	t_framebuffer	fb;
+	t_image_file	img;
+	int				err;
+
+	if (fb_init(&fb, opts->width, strip_rows(opts), opts->format == IMG_PFM))
+		return (printf("Malloc error: failed to allocate the frame\n"), 1);
+	if (image_open(&img, opts, fb.height))
+		return (fb_destroy(&fb), 1);
+	printf("RENDERING\n");
+	err = render_strips(&fb, &img, math, stats);
+	printf("RENDERED\n");
+	err = image_close(&img, err);
+	fb_destroy(&fb);
+	return (err);
+}
@@ -0,0 +1,114 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   write_image.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: sabruma <sabruma@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 22:57:34 by sabruma           #+#    #+#             */
+/*   Updated: 2026/10/18 00:28:25 by sabruma          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt_output.h"
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+// pwrite may stop short on big strips, it goes on where it stopped
+static int	pwrite_all(int fd, const char *buf, size_t size, off_t at)
+{
+	ssize_t	done;
+
+	while (size > 0)
+	{
+		done = pwrite(fd, buf, size, at);
+		if (done <= 0)
+			return (1);
+		buf += done;
+		size -= done;
+		at += done;
+	}
+	return (0);
+}
+
+// P6 keeps the 8 bit pixels, PF the colors before clamping scaled to
+// 1.0 = 255 with a negative scale for little endian. the header is the
+// only thing written in order, every row has its own offset after it
+int	image_open(t_image_file *img, const t_options *opts, int strip_rows)
+{
+	char	head[64];
+	int		len;
+
+	*img = (t_image_file){.opts = opts, .path = opts->output,
+		.height = opts->height,
+		.pfm = opts->format == IMG_PFM, .row_size = 3 * (size_t)opts->width};
+	if (img->pfm)
+		img->row_size *= sizeof(float);
+	if (img->pfm)
+		len = snprintf(head, sizeof(head), "PF\n%d %d\n-1.0\n",
+				opts->width, opts->height);
+	else
+		len = snprintf(head, sizeof(head), "P6\n%d %d\n255\n",
+				opts->width, opts->height);
+	img->header = len;
+	img->buf = malloc(img->row_size * strip_rows);
+	img->fd = open(opts->output, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+	if (!img->buf || img->fd < 0 || pwrite_all(img->fd, head, len, 0))
+		return (image_close(img, 1));
+	return (0);
+}
+
+// PFM rows go bottom to top: the strip is one run of the file
+// starting at its last row, filled in reverse
+static void	strip_pfm(const t_framebuffer *fb, float *out)
+{
+	const t_vec3	*src;
+	int				y;
+	int				x;
+
+	y = fb->height;
+	while (--y >= 0)
+	{
+		src = fb->hdr + y * fb->width;
+		x = -1;
+		while (++x < fb->width)
+		{
+			*out++ = src[x].x / 255.0f;
+			*out++ = src[x].y / 255.0f;
+			*out++ = src[x].z / 255.0f;
+		}
+	}
+}
+
+// row by row, the stride of the framebuffer may be wider than the strip
+static void	strip_ppm(const t_framebuffer *fb, uint8_t *out)
+{
+	int	y;
+
+	y = -1;
+	while (++y < fb->height)
+		rgb_pack_n(fb->pixels + (size_t)y * fb->stride,
+			out + (size_t)y * fb->width * 3, fb->width);
+}
+
+// the rows of the strip land where they belong in the file, so the
+// file never has to be held whole. returns 1 if it couldn't be written
+int	image_write_strip(t_image_file *img, const t_framebuffer *fb)
+{
+	off_t	row;
+
+	if (img->pfm && !fb->hdr)
+		return (1);
+	row = fb->y0;
+	if (img->pfm)
+	{
+		strip_pfm(fb, img->buf);
+		row = img->height - fb->y0 - fb->height;
+	}
+	else
+		strip_ppm(fb, img->buf);
+	return (pwrite_all(img->fd, img->buf, img->row_size * fb->height,
+			img->header + row * img->row_size));
+}
@@ -6,71 +6,50 @@
 /*   By: gio <gio@student.42.fr>                    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2026/03/30 17:47:07 by gio               #+#    #+#             */
-/*   Updated: 2026/03/30 17:47:14 by gio              ###   ########.fr       */
+/*   Updated: 2026/10/17 23:13:01 by gmu              ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "libft.h"
 #include "minirt.h"
+#include <sys/stat.h>
 
-/*splitta le parti e controla la lunghezza minima*/
-int	check_split(char *s1)
-{
-	int	i;
-	int	n_newline;
-
-	i = 0;
-	n_newline = 0;
-	while (s1[i])
-	{
-		if (s1[i] == '\n')
-			++n_newline;
-		++i;
-	}
-	if (n_newline < 4)
-		return (0);
-	return (1);
-}
-
-/*carica tutto il file
- * dentro un char* e toglie gli spazi doppiu
- */
+#define LOAD_CHUNK 65536
 
-/*il file deve avere una lunghezza determinata*/
-int	matrix_strlen_check(char **matrix)
+// the size of a regular file is known up front, so the buffer is
+// allocated once: one spare byte to see EOF without growing, one for
+// the terminator. pipes and the like grow it geometrically
+static size_t	load_size_hint(int fd)
 {
-	int	i;
+	struct stat	st;
 
-	i = 0;
-	while (matrix[i])
-	{
-		if (ft_strlen(matrix[i]) < 11)
-			return (1);
-		++i;
-	}
-	return (0);
+	if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0)
+		return ((size_t)st.st_size + 2);
+	return (LOAD_CHUNK);
 }
 
+// whole file in one buffer with big read()s straight into a strbuilder,
+// linear in the file size and with no copy of the text on the side.
+// the caller owns the returned string
 char	*read_from_file(int fd)
 {
-	char	*line;
-	char	*content;
-	char	*temp;
+	t_sb	sb;
+	ssize_t	n;
 
-	content = ft_strdup("");
-	if (!content)
+	sb = (t_sb){0};
+	if (!sb_ensure_capacity(&sb, load_size_hint(fd)))
 		return (NULL);
 	while (1)
 	{
-		line = get_next_line(fd);
-		if (!line)
+		if (sb.cap - sb.len < 2 && !sb_ensure_capacity(&sb, sb.cap + 1))
+			return (free(sb.buf), NULL);
+		n = read(fd, sb.buf + sb.len, sb.cap - sb.len - 1);
+		if (n < 0)
+			return (free(sb.buf), NULL);
+		if (n == 0)
 			break ;
-		temp = content;
-		content = ft_strjoin(content, line);
-		free(temp);
-		free(line);
-		if (!content)
-			return (NULL);
+		sb.len += n;
 	}
-	return (compress_space(content));
+	sb.buf[sb.len] = '\0';
+	return (sb.buf);
 }
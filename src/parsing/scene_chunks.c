@@ -0,0 +1,82 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   scene_chunks.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: gmu <marvin@42.fr>                         +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:27:46 by gmu               #+#    #+#             */
+/*   Updated: 2026/10/17 23:35:36 by gmu              ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+
+// pezzi di circa len / n byte, ognuno spostato in avanti fino a dopo
+// il primo '\n': nessuna riga resta a cavallo di due pezzi
+void	split_chunks(const char *text, size_t len, t_chunk *ch, int n)
+{
+	const char	*cut;
+	int			i;
+
+	ch[0].start = text;
+	i = 0;
+	while (++i < n)
+	{
+		cut = text + len / n * i;
+		if (cut < ch[i - 1].start)
+			cut = ch[i - 1].start;
+		while (*cut && *cut != '\n')
+			cut++;
+		if (*cut)
+			cut++;
+		ch[i].start = cut;
+		ch[i - 1].end = cut;
+	}
+	ch[n - 1].end = text + len;
+}
+
+// un blocco solo per gli elementi di tutti i pezzi, piu' uno per ELEM_END
+// in fondo: liberare il primo pezzo libera tutto
+bool	chunk_arena(t_arena *a, t_chunk *ch, int n)
+{
+	size_t	size;
+	int		i;
+
+	size = ARENA_ALIGN;
+	i = -1;
+	while (++i < n)
+	{
+		ch[i].capacity = count_lines(ch[i].start, ch[i].end);
+		size += arena_round(ch[i].capacity * sizeof(t_element));
+	}
+	if (!arena_init(a, size))
+		return (false);
+	i = -1;
+	while (++i < n)
+		ch[i].elements = arena_alloc(a, ch[i].capacity * sizeof(t_element));
+	return (true);
+}
+
+// come parse_scene ma su un pezzo solo e senza stampare niente:
+// gli errori li riporta il parser seriale. elements e' gia' pronto,
+// capacity righe al massimo
+void	*chunk_main(void *arg)
+{
+	t_chunk		*ch;
+	t_cursor	c;
+	int			got;
+
+	ch = arg;
+	c = (t_cursor){.p = ch->start, .line = 1, .quiet = true};
+	while (!ch->failed && c.p < ch->end)
+	{
+		got = parse_line(&c, &ch->elements[ch->count]);
+		ch->failed = got < 0;
+		ch->count += got;
+		if (*c.p == '\n')
+			c.p++;
+	}
+	ch->seen = c.seen;
+	return (NULL);
+}
@@ -0,0 +1,46 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   scene_cursor.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: gmu <marvin@42.fr>                         +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:12:16 by gmu               #+#    #+#             */
+/*   Updated: 2026/10/17 23:28:17 by gmu              ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "libft.h"
+#include "minirt.h"
+
+// spazi dentro la riga, il '\n' no
+static bool	is_blank(char ch)
+{
+	return (ch == ' ' || ch == '\t' || ch == '\r' || ch == '\v' || ch == '\f');
+}
+
+void	skip_blanks(t_cursor *c)
+{
+	while (is_blank(*c->p))
+		c->p++;
+}
+
+bool	at_field_end(const t_cursor *c)
+{
+	return (is_blank(*c->p) || *c->p == '\n' || *c->p == '\0');
+}
+
+// dopo l'ultimo campo ci possono essere solo spazi
+bool	end_of_line(t_cursor *c)
+{
+	skip_blanks(c);
+	return (*c->p == '\n' || *c->p == '\0');
+}
+
+// stampa il primo errore con la riga, ritorna sempre false
+bool	parse_error(const t_cursor *c, const char *what, const char *id)
+{
+	if (!c->quiet)
+		printf("Error: line %d: %s in %s\n", c->line, what, id);
+	return (false);
+}
@@ -0,0 +1,51 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   scene_integers.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: gmu <marvin@42.fr>                         +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:12:23 by gmu               #+#    #+#             */
+/*   Updated: 2026/10/17 23:12:23 by gmu              ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "libft.h"
+#include "minirt.h"
+
+// solo cifre, niente segno, al massimo max
+static bool	read_digits(t_cursor *c, int max, int *out)
+{
+	if (!ft_isdigit(*c->p))
+		return (false);
+	*out = 0;
+	while (ft_isdigit(*c->p))
+	{
+		*out = *out * 10 + (*c->p++ - '0');
+		if (*out > max)
+			return (false);
+	}
+	return (true);
+}
+
+bool	read_int(t_cursor *c, int max, int *out)
+{
+	skip_blanks(c);
+	return (read_digits(c, max, out) && at_field_end(c));
+}
+
+// r,g,b in [0,255]
+bool	read_rgb(t_cursor *c, t_rgb *out)
+{
+	int	rgb[3];
+
+	skip_blanks(c);
+	if (!read_digits(c, 255, &rgb[0]) || *c->p++ != ',')
+		return (false);
+	if (!read_digits(c, 255, &rgb[1]) || *c->p++ != ',')
+		return (false);
+	if (!read_digits(c, 255, &rgb[2]) || !at_field_end(c))
+		return (false);
+	*out = rgb_new(rgb[0], rgb[1], rgb[2]);
+	return (true);
+}
@@ -0,0 +1,54 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   scene_numbers.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: gmu <marvin@42.fr>                         +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:12:23 by gmu               #+#    #+#             */
+/*   Updated: 2026/10/17 23:18:34 by gmu              ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+#include <math.h>
+
+// numero decimale (segno ed esponente compresi) arrotondato dritto a
+// float, con almeno una cifra e che non vada a inf
+static bool	read_float(t_cursor *c, float *out)
+{
+	const char	*end;
+
+	end = parse_float(c->p, out);
+	if (!end || !isfinite(*out))
+		return (false);
+	c->p = end;
+	return (true);
+}
+
+// un campo con un numero solo
+bool	read_number(t_cursor *c, float *out)
+{
+	skip_blanks(c);
+	return (read_float(c, out) && at_field_end(c));
+}
+
+// x,y,z senza spazi in mezzo
+bool	read_vec3(t_cursor *c, t_vec3 *out)
+{
+	skip_blanks(c);
+	if (!read_float(c, &out->x) || *c->p++ != ',')
+		return (false);
+	if (!read_float(c, &out->y) || *c->p++ != ',')
+		return (false);
+	return (read_float(c, &out->z) && at_field_end(c));
+}
+
+// x,y,z con ogni componente in [-1,1]
+bool	read_direction(t_cursor *c, t_vec3 *out)
+{
+	if (!read_vec3(c, out))
+		return (false);
+	return (out->x >= -1.0f && out->x <= 1.0f && out->y >= -1.0f
+		&& out->y <= 1.0f && out->z >= -1.0f && out->z <= 1.0f);
+}
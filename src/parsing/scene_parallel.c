@@ -0,0 +1,115 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   scene_parallel.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: gmu <marvin@42.fr>                         +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:25:28 by gmu               #+#    #+#             */
+/*   Updated: 2026/10/17 23:35:36 by gmu              ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "libft.h"
+#include "minirt.h"
+
+// A, C e L una volta sola in tutto il file, non per pezzo: se un pezzo
+// e' fallito o la scena non e' completa non si unisce niente
+static bool	chunks_ok(const t_chunk *ch, int n, size_t *total)
+{
+	int	seen;
+	int	i;
+
+	*total = 0;
+	seen = 0;
+	i = -1;
+	while (++i < n)
+	{
+		if (ch[i].failed || (seen & ch[i].seen))
+			return (false);
+		seen |= ch[i].seen;
+		*total += ch[i].count;
+	}
+	return (seen == (SEEN_A | SEEN_C | SEEN_L) && *total >= 4);
+}
+
+// i pezzi stanno uno dopo l'altro nello stesso blocco, il primo
+// all'inizio: si compattano in avanti senza copiarli altrove
+static t_element	*merge_chunks(const t_chunk *ch, int n)
+{
+	t_element	*all;
+	size_t		total;
+	int			i;
+
+	if (!chunks_ok(ch, n, &total))
+		return (NULL);
+	all = ch[0].elements;
+	total = 0;
+	i = -1;
+	while (++i < n)
+	{
+		ft_memmove(all + total, ch[i].elements,
+			ch[i].count * sizeof(t_element));
+		total += ch[i].count;
+	}
+	all[total].type = ELEM_END;
+	return (all);
+}
+
+// il thread chiamante fa il primo pezzo, quelli che non partono
+// vengono fatti da lui alla fine
+static void	run_chunks(t_chunk *ch, int n)
+{
+	int	i;
+
+	i = 0;
+	while (++i < n)
+		ch[i].started = !pthread_create(&ch[i].thread, NULL, chunk_main,
+				&ch[i]);
+	chunk_main(&ch[0]);
+	while (--i > 0)
+	{
+		if (ch[i].started)
+			pthread_join(ch[i].thread, NULL);
+		else
+			chunk_main(&ch[i]);
+	}
+}
+
+// se qualcosa va storto il blocco non serve piu' a nessuno
+static t_element	*parse_chunks(t_chunk *ch, int n)
+{
+	t_element	*all;
+	t_arena		a;
+
+	if (!chunk_arena(&a, ch, n))
+		return (NULL);
+	run_chunks(ch, n);
+	all = merge_chunks(ch, n);
+	if (!all)
+		arena_destroy(&a);
+	return (all);
+}
+
+// un thread ogni PARSE_CHUNK_MIN byte al massimo
+t_element	*parse_scene_parallel(const char *text, int threads)
+{
+	t_chunk		*ch;
+	t_element	*all;
+	size_t		len;
+
+	len = ft_strlen(text);
+	if ((size_t)threads > len / PARSE_CHUNK_MIN)
+		threads = len / PARSE_CHUNK_MIN;
+	ch = NULL;
+	if (threads > 1)
+		ch = ft_calloc(threads, sizeof(t_chunk));
+	if (!ch)
+		return (parse_scene(text));
+	split_chunks(text, len, ch, threads);
+	all = parse_chunks(ch, threads);
+	free(ch);
+	if (!all)
+		return (parse_scene(text));
+	return (all);
+}
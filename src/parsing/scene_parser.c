@@ -0,0 +1,111 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   scene_parser.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: gmu <marvin@42.fr>                         +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:12:49 by gmu               #+#    #+#             */
+/*   Updated: 2026/10/17 23:30:40 by gmu              ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "libft.h"
+#include "minirt.h"
+
+// quante righe al massimo in [s, end), per allocare gli elementi
+// una volta sola; end NULL vuol dire fino al '\0'
+size_t	count_lines(const char *s, const char *end)
+{
+	size_t	count;
+
+	count = 1;
+	while (s != end && *s)
+		if (*s++ == '\n')
+			++count;
+	return (count);
+}
+
+// identificatore e parser di ogni tipo, nell'ordine di t_elem_type
+static const t_elem_syntax	g_syntax[ELEM_TYPES] = {
+{NULL, NULL},
+{"A", parse_ambient},
+{"C", parse_camera},
+{"L", parse_light},
+{"sp", parse_sphere},
+{"pl", parse_plane},
+{"cy", parse_cylinder}
+};
+
+// l'identificatore deve essere seguito da uno spazio
+static bool	match_id(t_cursor *c, const char *id)
+{
+	size_t	len;
+
+	len = ft_strlen(id);
+	if (ft_strncmp(c->p, id, len) != 0
+		|| (c->p[len] != ' ' && c->p[len] != '\t'))
+		return (false);
+	c->p += len;
+	return (true);
+}
+
+// 1 se ha scritto un elemento, 0 per le righe vuote, -1 sugli errori
+int	parse_line(t_cursor *c, t_element *e)
+{
+	int	type;
+
+	skip_blanks(c);
+	if (*c->p == '\n' || *c->p == '\0')
+		return (0);
+	type = ELEM_END + 1;
+	while (type < ELEM_TYPES && !match_id(c, g_syntax[type].id))
+		type++;
+	if (type == ELEM_TYPES)
+		return (parse_error(c, "unknown element", "scene"), -1);
+	if (!g_syntax[type].parse(c, e))
+		return (-1);
+	if (!end_of_line(c))
+		return (parse_error(c, "too many fields", g_syntax[type].id), -1);
+	return (1);
+}
+
+// A, C, L e almeno un oggetto
+static bool	scene_complete(const t_cursor *c, size_t count)
+{
+	if (c->seen != (SEEN_A | SEEN_C | SEEN_L) || count < 4)
+	{
+		printf("Error: too few items or missing data\n");
+		return (false);
+	}
+	return (true);
+}
+
+// una passata sul testo, gli elementi escono gia' convertiti
+t_element	*parse_scene(const char *text)
+{
+	t_cursor	c;
+	t_element	*elements;
+	size_t		count;
+	int			got;
+
+	elements = malloc(sizeof(t_element) * (count_lines(text, NULL) + 1));
+	if (!elements)
+		return (printf("Malloc error: failed to allocate the scene\n"), NULL);
+	c = (t_cursor){.p = text, .line = 1};
+	count = 0;
+	while (*c.p)
+	{
+		got = parse_line(&c, &elements[count]);
+		if (got < 0)
+			return (free(elements), NULL);
+		count += got;
+		if (*c.p == '\n')
+			c.p++;
+		c.line++;
+	}
+	elements[count].type = ELEM_END;
+	if (!scene_complete(&c, count))
+		return (free(elements), NULL);
+	return (elements);
+}
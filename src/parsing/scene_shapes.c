@@ -0,0 +1,57 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   scene_shapes.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: gmu <marvin@42.fr>                         +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:12:35 by gmu               #+#    #+#             */
+/*   Updated: 2026/10/17 23:30:40 by gmu              ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "libft.h"
+#include "minirt.h"
+
+// sp <x,y,z> <diameter> <r,g,b>
+bool	parse_sphere(t_cursor *c, t_element *e)
+{
+	e->type = ELEM_SPHERE;
+	if (!read_vec3(c, &e->value.sp.center))
+		return (parse_error(c, "coordinates format wrong", "sp"));
+	if (!read_number(c, &e->value.sp.diameter))
+		return (parse_error(c, "sphere diameter wrong", "sp"));
+	if (!read_rgb(c, &e->value.sp.color))
+		return (parse_error(c, "rgb format wrong", "sp"));
+	return (true);
+}
+
+// pl <x,y,z> <normal [-1,1]> <r,g,b>
+bool	parse_plane(t_cursor *c, t_element *e)
+{
+	e->type = ELEM_PLANE;
+	if (!read_vec3(c, &e->value.pl.point))
+		return (parse_error(c, "coordinates format wrong", "pl"));
+	if (!read_direction(c, &e->value.pl.normal))
+		return (parse_error(c, "normalizzation wrong", "pl"));
+	if (!read_rgb(c, &e->value.pl.color))
+		return (parse_error(c, "rgb format wrong", "pl"));
+	return (true);
+}
+
+// cy <x,y,z> <axis [-1,1]> <diameter> <height> <r,g,b>
+bool	parse_cylinder(t_cursor *c, t_element *e)
+{
+	e->type = ELEM_CYLINDER;
+	if (!read_vec3(c, &e->value.cy.center))
+		return (parse_error(c, "coordinates format wrong", "cy"));
+	if (!read_direction(c, &e->value.cy.axis))
+		return (parse_error(c, "normalizzation wrong", "cy"));
+	if (!read_number(c, &e->value.cy.diameter))
+		return (parse_error(c, "cylinder diameter wrong", "cy"));
+	if (!read_number(c, &e->value.cy.height))
+		return (parse_error(c, "cylinder height wrong", "cy"));
+	if (!read_rgb(c, &e->value.cy.color))
+		return (parse_error(c, "rgb format wrong", "cy"));
+	return (true);
+}
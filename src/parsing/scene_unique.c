@@ -0,0 +1,70 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   scene_unique.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: gmu <marvin@42.fr>                         +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:12:35 by gmu               #+#    #+#             */
+/*   Updated: 2026/10/17 23:30:40 by gmu              ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "libft.h"
+#include "minirt.h"
+
+static bool	in_range(float value, float min, float max)
+{
+	return (value >= min && value <= max);
+}
+
+// A <ratio [0,1]> <r,g,b>
+bool	parse_ambient(t_cursor *c, t_element *e)
+{
+	if (c->seen & SEEN_A)
+		return (parse_error(c, "declared twice", "A"));
+	c->seen |= SEEN_A;
+	e->type = ELEM_AMBIENT;
+	if (!read_number(c, &e->value.a.brightness)
+		|| !in_range(e->value.a.brightness, 0.0f, 1.0f))
+		return (parse_error(c, "ratio wrong", "A"));
+	if (!read_rgb(c, &e->value.a.color))
+		return (parse_error(c, "rgb format wrong", "A"));
+	return (true);
+}
+
+// C <x,y,z> <orientation [-1,1]> <fov [0,180]>
+bool	parse_camera(t_cursor *c, t_element *e)
+{
+	int	fov;
+
+	if (c->seen & SEEN_C)
+		return (parse_error(c, "declared twice", "C"));
+	c->seen |= SEEN_C;
+	e->type = ELEM_CAMERA;
+	if (!read_vec3(c, &e->value.c.viewpoint))
+		return (parse_error(c, "coordinates format wrong", "C"));
+	if (!read_direction(c, &e->value.c.orientation))
+		return (parse_error(c, "orientation wrong", "C"));
+	if (!read_int(c, 180, &fov))
+		return (parse_error(c, "fov wrong", "C"));
+	e->value.c.fov = fov;
+	return (true);
+}
+
+// L <x,y,z> <brightness [0,1]> <r,g,b>
+bool	parse_light(t_cursor *c, t_element *e)
+{
+	if (c->seen & SEEN_L)
+		return (parse_error(c, "declared twice", "L"));
+	c->seen |= SEEN_L;
+	e->type = ELEM_LIGHT;
+	if (!read_vec3(c, &e->value.l.position))
+		return (parse_error(c, "coordinates format wrong", "L"));
+	if (!read_number(c, &e->value.l.brightness)
+		|| !in_range(e->value.l.brightness, 0.0f, 1.0f))
+		return (parse_error(c, "brightness wrong", "L"));
+	if (!read_rgb(c, &e->value.l.color))
+		return (parse_error(c, "rgb format wrong", "L"));
+	return (true);
+}
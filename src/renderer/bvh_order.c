@@ -0,0 +1,88 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bvh_order.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: sabruma <sabruma@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 22:42:59 by sabruma           #+#    #+#             */
+/*   Updated: 2026/10/17 23:35:21 by sabruma          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt_renderer.h"
+
+// spheres first inside each leaf so the leaf has a single sphere run
+static void	leaf_sort(t_bvh_ref *refs, int count)
+{
+	t_bvh_ref	tmp;
+	int			i;
+	int			j;
+
+	i = 0;
+	while (++i < count)
+	{
+		tmp = refs[i];
+		j = i;
+		while (j > 0 && tmp.obj == OBJ_SPHERE && refs[j - 1].obj != OBJ_SPHERE)
+		{
+			refs[j] = refs[j - 1];
+			j--;
+		}
+		refs[j] = tmp;
+	}
+}
+
+// copies the primitives in the order the refs visit them and points
+// the refs at the new slots
+static void	gather(t_math *m, const t_sphere_math *sp,
+				const t_cylinder_math *cy)
+{
+	int	i;
+	int	s;
+	int	c;
+
+	s = 0;
+	c = 0;
+	i = -1;
+	while (++i < m->bvh.ref_count)
+	{
+		if (m->bvh.refs[i].obj == OBJ_SPHERE)
+		{
+			m->spheres[s] = sp[m->bvh.refs[i].idx];
+			m->bvh.refs[i].idx = s++;
+		}
+		else
+		{
+			m->cys[c] = cy[m->bvh.refs[i].idx];
+			m->bvh.refs[i].idx = c++;
+		}
+	}
+}
+
+// lays spheres and cylinders out in BVH leaf order: the spheres of a leaf
+// become one contiguous run for sphere_intersect_n and neighbouring leaves
+// share cache lines. sp and cy are the arrays in the order bvh_build saw
+void	bvh_order(t_math *m, const t_sphere_math *sp, const t_cylinder_math *cy)
+{
+	int	i;
+
+	i = -1;
+	while (++i < m->bvh.node_count)
+		if (m->bvh.nodes[i].count)
+			leaf_sort(m->bvh.refs + m->bvh.nodes[i].first,
+				m->bvh.nodes[i].count);
+	gather(m, sp, cy);
+}
+
+// spheres at the start of a leaf, as a {first index, count} run
+void	leaf_spheres(const t_math *m, const t_bvh_node *node, int range[2])
+{
+	const t_bvh_ref	*ref;
+
+	ref = m->bvh.refs + node->first;
+	range[0] = ref->idx;
+	range[1] = 0;
+	while (range[1] < node->count && ref[range[1]].obj == OBJ_SPHERE)
+		range[1]++;
+}
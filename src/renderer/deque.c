@@ -0,0 +1,51 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   deque.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: sabruma <sabruma@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 22:22:06 by sabruma           #+#    #+#             */
+/*   Updated: 2026/10/18 01:21:08 by sabruma          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt_pool.h"
+
+// before the workers start, no lock: appends first, first + step, ...
+// up to end (excluded), returns how many items the deque holds
+int	deque_fill(t_deque *dq, int first, int step, int end)
+{
+	while (first < end)
+	{
+		dq->items[dq->tail++] = first;
+		first += step;
+	}
+	return (dq->tail);
+}
+
+// owner side: newest tile first
+bool	deque_pop(t_deque *dq, int *item)
+{
+	bool	found;
+
+	pthread_mutex_lock(&dq->lock);
+	found = dq->head < dq->tail;
+	if (found)
+		*item = dq->items[--dq->tail];
+	pthread_mutex_unlock(&dq->lock);
+	return (found);
+}
+
+// thief side: oldest tile first, so owner and thief rarely meet
+bool	deque_steal(t_deque *dq, int *item)
+{
+	bool	found;
+
+	pthread_mutex_lock(&dq->lock);
+	found = dq->head < dq->tail;
+	if (found)
+		*item = dq->items[dq->head++];
+	pthread_mutex_unlock(&dq->lock);
+	return (found);
+}
@@ -6,17 +6,19 @@
 /*   By: sabruma <sabruma@student.42firenze.it>     +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2026/03/17 18:44:12 by sabruma           #+#    #+#             */
-/*   Updated: 2026/03/23 00:30:02 by sabruma          ###   ########.fr       */
+/*   Updated: 2026/10/17 23:35:21 by sabruma          ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "math_engine.h"
 #include <stdlib.h>
+#include <sys/mman.h>
 
+// a built t_math is the head of the one block holding every array,
+// one loaded from a .rtb only owns the mapping
 void	destroy_math(t_math *math_engine)
 {
-	free(math_engine->cys);
-	free(math_engine->planes);
-	free(math_engine->spheres);
+	if (math_engine->mapping)
+		munmap(math_engine->mapping, math_engine->mapping_size);
 	free(math_engine);
 }
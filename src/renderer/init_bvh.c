@@ -0,0 +1,66 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   init_bvh.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: sabruma <sabruma@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 22:28:17 by sabruma           #+#    #+#             */
+/*   Updated: 2026/10/17 23:35:21 by sabruma          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt_renderer.h"
+#include "memory.h"
+
+// scratch for the build: the prims and the arrays in parse order,
+// which bvh_order gathers back into the scene block
+static t_bvh_prim	*scratch_init(t_arena *tmp, const t_math *m,
+						t_sphere_math **sp, t_cylinder_math **cy)
+{
+	t_bvh_prim	*prims;
+	size_t		sp_size;
+	size_t		cy_size;
+
+	sp_size = (m->sp_count + 1) * sizeof(t_sphere_math);
+	cy_size = (m->cy_count + 1) * sizeof(t_cylinder_math);
+	if (!arena_init(tmp, arena_round(sp_size) + arena_round(cy_size)
+			+ arena_round((m->sp_count + m->cy_count + 1)
+				* sizeof(t_bvh_prim))))
+		return (NULL);
+	*sp = ft_memcpy(arena_alloc(tmp, sp_size), m->spheres, sp_size);
+	*cy = ft_memcpy(arena_alloc(tmp, cy_size), m->cys, cy_size);
+	prims = arena_alloc(tmp, (m->sp_count + m->cy_count + 1)
+			* sizeof(t_bvh_prim));
+	return (prims);
+}
+
+// builds the BVH over every sphere and cylinder once the arrays are filled,
+// then reorders the arrays to follow the leaves and packs the spheres
+// into the SoA store the closest-hit loop reads. all of it lands in the
+// storage malloc_math set aside, the scratch goes with one free
+t_math	*init_bvh(t_math *m)
+{
+	t_arena			tmp;
+	t_bvh_prim		*prims;
+	t_sphere_math	*sp;
+	t_cylinder_math	*cy;
+	int				i;
+
+	prims = scratch_init(&tmp, m, &sp, &cy);
+	if (!prims)
+		return (destroy_math(m), NULL);
+	i = -1;
+	while (++i < m->sp_count)
+		prims[i] = bvh_prim(sphere_bounds(&sp[i]),
+				(t_bvh_ref){.obj = OBJ_SPHERE, .idx = i});
+	i = -1;
+	while (++i < m->cy_count)
+		prims[m->sp_count + i] = bvh_prim(cylinder_bounds(&cy[i]),
+				(t_bvh_ref){.obj = OBJ_CYLINDER, .idx = i});
+	bvh_build(&m->bvh, prims, m->sp_count + m->cy_count);
+	bvh_order(m, sp, cy);
+	sphere_soa_init(&m->sp_soa, m->sp_soa.x, m->spheres, m->sp_count);
+	arena_destroy(&tmp);
+	return (m);
+}
@@ -6,112 +6,89 @@
 /*   By: sabruma <sabruma@student.42.fr>            +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2026/03/17 17:53:42 by sabruma           #+#    #+#             */
-/*   Updated: 2026/03/31 23:11:35 by sabruma          ###   ########.fr       */
+/*   Updated: 2026/10/17 23:35:21 by sabruma          ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "minirt_renderer.h"
-#include "strings.h"
 #include "memory.h"
 
-static void		count_objects(int *idx, int len, t_element *d);
-static t_math	*malloc_math(t_element *data_file);
-static t_math	*create_unique(t_math *math, t_element *data);
+// one entry per t_elem_type, ELEM_END never gets here
+static const t_elem_init	g_init[ELEM_TYPES] = {
+	NULL,
+	init_ambient,
+	init_camera,
+	init_light,
+	init_sphere,
+	init_plane,
+	init_cylinder
+};
 
-// TODO: if-elif cascade should be extracted each to its own function
-// for id == "A" and id == "L", keep utils in this file,
-// the others go to utils.c.
-// Assumes that data_file doesn't contain elements with a NULL id
-// Follows manual RAII for each entity
-t_math	*init_math(t_element *d)
+// every array of the scene, each rounded to a cache line
+static size_t	math_size(const int *count)
 {
-	t_math	*m;
-	int		i;
-	int		j;
-	int		k;
+	size_t	sp;
+	size_t	n;
 
-	i = 0;
-	j = 0;
-	k = 0;
-	m = malloc_math(d);
-	if (!m)
-		return (NULL);
-	while (d->id)
-	{
-		if (!create_unique(m, d))
-			return (NULL);
-		else if (!init_spheres(m, d, &i))
-			return (NULL);
-		else if (!init_planes(m, d, &j))
-			return (NULL);
-		else if (!init_cylinders(m, d, &k))
-			return (NULL);
-		d++;
-	}
-	return (m);
+	sp = count[ELEM_SPHERE];
+	n = sp + count[ELEM_CYLINDER];
+	return (arena_round(sizeof(t_math))
+		+ arena_round((sp + 1) * sizeof(t_sphere_math))
+		+ arena_round((count[ELEM_PLANE] + 1) * sizeof(t_plane_math))
+		+ arena_round((count[ELEM_CYLINDER] + 1) * sizeof(t_cylinder_math))
+		+ arena_round(2 * (n + 1) * sizeof(t_bvh_node))
+		+ arena_round((n + 1) * sizeof(t_bvh_ref))
+		+ arena_round(sphere_soa_size(sp)));
 }
 
-static t_math	*create_unique(t_math *m, t_element *d)
+// one pass to size every array, indexed by the element type, then one
+// block for all of them: the t_math comes first so freeing it frees the
+// scene. the BVH and SoA storage is set aside here for init_bvh
+static t_math	*malloc_math(const t_element *d)
 {
-	if (ft_strcmp(d->id, "A") == 0)
-	{
-		if (create_ambient(&m->ambient, (t_ambient *)&d->value))
-			return (destroy_math(m), NULL);
-	}
-	if (ft_strcmp(d->id, "C") == 0)
-	{
-		if (create_camera(&m->camera, (t_camera *)&d->value))
-			return (destroy_math(m), NULL);
-	}
-	if (ft_strcmp(d->id, "L") == 0)
-	{
-		if (create_light(&m->light, (t_light *)&d->value))
-			return (destroy_math(m), NULL);
-	}
+	t_arena	a;
+	t_math	*m;
+	int		count[ELEM_TYPES];
+
+	ft_bzero(count, sizeof(count));
+	while (d->type != ELEM_END)
+		count[d++->type]++;
+	if (!arena_init(&a, math_size(count)))
+		return (NULL);
+	m = arena_alloc(&a, sizeof(t_math));
+	m->cy_count = count[ELEM_CYLINDER];
+	m->sp_count = count[ELEM_SPHERE];
+	m->pl_count = count[ELEM_PLANE];
+	m->spheres = arena_alloc(&a, (m->sp_count + 1) * sizeof(t_sphere_math));
+	m->planes = arena_alloc(&a, (m->pl_count + 1) * sizeof(t_plane_math));
+	m->cys = arena_alloc(&a, (m->cy_count + 1) * sizeof(t_cylinder_math));
+	m->bvh.nodes = arena_alloc(&a, 2 * (m->sp_count + m->cy_count + 1)
+			* sizeof(t_bvh_node));
+	m->bvh.refs = arena_alloc(&a, (m->sp_count + m->cy_count + 1)
+			* sizeof(t_bvh_ref));
+	m->sp_soa.x = arena_alloc(&a, sphere_soa_size(m->sp_count));
 	return (m);
 }
 
-static void	count_objects(int *idx, int len, t_element *d)
+// every element goes through the table of its type, next[type] is the
+// slot the next element of that type fills
+// Follows manual RAII for each entity
+t_math	*init_math(t_element *d)
 {
-	int	i;
+	t_math	*m;
+	int		next[ELEM_TYPES];
 
-	i = 0;
-	while (i < len)
-		idx[i++] = 0;
-	while (d->id)
+	if (!d)
+		return (NULL);
+	m = malloc_math(d);
+	if (!m)
+		return (NULL);
+	ft_bzero(next, sizeof(next));
+	while (d->type != ELEM_END)
 	{
-		if (ft_strcmp(d->id, "cy") == 0)
-			idx[0]++;
-		if (ft_strcmp(d->id, "sp") == 0)
-			idx[1]++;
-		if (ft_strcmp(d->id, "pl") == 0)
-			idx[2]++;
+		if (g_init[d->type](m, d, next))
+			return (destroy_math(m), NULL);
 		d++;
 	}
-}
-
-static t_math	*malloc_math(t_element *data_file)
-{
-	t_math	*math;
-	int		idx[3];
-
-	if (!data_file)
-		return (NULL);
-	math = ft_calloc(1, sizeof(t_math));
-	if (!math)
-		return (NULL);
-	count_objects(idx, 3, data_file);
-	math->cy_count = idx[0];
-	math->sp_count = idx[1];
-	math->pl_count = idx[2];
-	math->cys = malloc(idx[0] * sizeof(t_cylinder_math));
-	if (!math->cys)
-		return (destroy_math(math), NULL);
-	math->spheres = malloc(idx[1] * sizeof(t_sphere_math));
-	if (!math->spheres)
-		return (destroy_math(math), NULL);
-	math->planes = malloc(idx[2] * sizeof(t_plane_math));
-	if (!math->planes)
-		return (destroy_math(math), NULL);
-	return (math);
+	return (init_bvh(m));
 }
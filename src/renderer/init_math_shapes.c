@@ -0,0 +1,29 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   init_math_shapes.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: sabruma <sabruma@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:29:35 by sabruma           #+#    #+#             */
+/*   Updated: 2026/10/17 23:29:35 by sabruma          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt_renderer.h"
+
+// shapes fill their array in file order, malloc_math counted them
+int	init_sphere(t_math *m, t_element *e, int *next)
+{
+	return (create_sphere(&m->spheres[next[ELEM_SPHERE]++], &e->value.sp));
+}
+
+int	init_plane(t_math *m, t_element *e, int *next)
+{
+	return (create_plane(&m->planes[next[ELEM_PLANE]++], &e->value.pl));
+}
+
+int	init_cylinder(t_math *m, t_element *e, int *next)
+{
+	return (create_cylinder(&m->cys[next[ELEM_CYLINDER]++], &e->value.cy));
+}
@@ -6,7 +6,7 @@
 /*   By: sabruma <sabruma@student.42.fr>            +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2026/03/31 22:18:38 by sabruma           #+#    #+#             */
-/*   Updated: 2026/03/31 23:48:11 by gmu              ###   ########.fr       */
+/*   Updated: 2026/10/17 23:06:10 by sabruma          ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -49,7 +49,5 @@ t_vec3	lighting(t_material material, t_math *math, t_hit hit)
 		diff = vec3_scale(vec3_scale(hit.color, math->light.intensity), dot);
 		shiny = specular(math, material, lightv, hit);
 	}
-	return (vec3_add(vec3_add
-			(vec3_linear_to_srgb(vec3_gamma_correct
-					(vec3_srgb_to_linear(ambient), 2.0f)), diff), shiny));
+	return (vec3_add(vec3_add(vec3_srgb_gamma2(ambient), diff), shiny));
 }
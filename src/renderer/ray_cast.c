@@ -6,7 +6,7 @@
 /*   By: sabruma <sabruma@student.42.fr>            +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2026/03/16 17:08:50 by sabruma           #+#    #+#             */
-/*   Updated: 2026/03/31 23:40:51 by gmu              ###   ########.fr       */
+/*   Updated: 2026/10/18 00:03:42 by sabruma          ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -28,47 +28,50 @@ static t_vec3	cast_shadows(const t_hit *hit, t_math *math, const t_ray ray);
 // 	return (vec3_add(vec3_scale(a, 1.0f - val), vec3_scale(b, val)));
 // }
 
-// here go shaders calls and texture mappings
 t_rgb	ray_cast(const t_ray ray, t_math *math)
 {
-	t_vec3	color;
 	t_hit	hit;
 	int		i;
 
+	trace(ray, math, &hit, &i);
+	return (vec3_to_rgb(ray_shade(ray, math, &hit)));
+}
+
+// here go shaders calls and texture mappings,
+// hit comes from trace or trace_packet (OBJ_NULL when nothing was hit).
+// the color is still unclamped, 255 = full intensity
+t_vec3	ray_shade(const t_ray ray, t_math *math, const t_hit *hit)
+{
+	t_vec3	color;
+
 	color = vec3_zero();
-	if (trace(ray, math, &hit, &i))
-	{
-		color = vec3_scale(hit.color, math->ambient.intensity);
-		color = vec3_gamma_correct(vec3_srgb_to_linear(color), 2.0f);
-		color = vec3_linear_to_srgb(color);
-		color = cast_shadows(&hit, math, ray);
-	}
-	return (vec3_to_rgb(color));
+	if (hit->obj != OBJ_NULL)
+		color = cast_shadows(hit, math, ray);
+	return (color);
 }
 
 static t_vec3	cast_shadows(const t_hit *hit, t_math *math, const t_ray ray)
 {
-	int			j;
 	t_ray		shadow;
-	t_hit		shit;
+	t_vec3		to_light;
 	t_material	material;
 
 	material = (t_material){0};
+	to_light = vec3_sub(math->light.point, hit->point);
 	shadow = (t_ray){
 		.origin = hit->point,
-		.direction = vec3_normalize(vec3_sub(math->light.point, hit->point)),
-		.t_max = ray.t_max,
+		.direction = vec3_normalize(to_light),
+		.t_max = vec3_length(to_light),
 		.t_min = ray.t_min
 	};
-	if (!trace(shadow, math, &shit, &j))
-	{
-		if (hit->obj == OBJ_SPHERE)
-			material = (t_material){.specular = 0.5f, .shininess = 32.0f};
-		else if (hit->obj == OBJ_PLANE)
-			material = (t_material){.specular = 0.3f, .shininess = 8.0f};
-		else if (hit->obj == OBJ_CYLINDER)
-			material = (t_material){.specular = 0.4f, .shininess = 16.0f};
-		return (lighting(material, math, *hit));
-	}
-	return (vec3_zero());
+	stat_add(STAT_SHADOW, 1);
+	if (trace_occluded(shadow, math))
+		return (stat_add(STAT_OCCLUDED, 1), vec3_zero());
+	if (hit->obj == OBJ_SPHERE)
+		material = (t_material){.specular = 0.5f, .shininess = 32.0f};
+	else if (hit->obj == OBJ_PLANE)
+		material = (t_material){.specular = 0.3f, .shininess = 8.0f};
+	else if (hit->obj == OBJ_CYLINDER)
+		material = (t_material){.specular = 0.4f, .shininess = 16.0f};
+	return (lighting(material, math, *hit));
 }
@@ -6,7 +6,7 @@
 /*   By: sabruma <sabruma@student.42.fr>            +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2026/03/18 18:58:38 by sabruma           #+#    #+#             */
-/*   Updated: 2026/03/31 22:42:35 by sabruma          ###   ########.fr       */
+/*   Updated: 2026/10/18 01:22:00 by sabruma          ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -117,37 +117,138 @@
 // }
 
 #include "minirt_renderer.h"
+#include <stdlib.h>
 
-static void	put_pixel(t_mlx_minirt *mlx, int x, int y, t_rgb color);
+static int	shade_pixel(t_render *r, t_pixel at, const t_ray ray,
+				const t_hit *hit);
 
-// questa già funzionava, perché modificarla?
-// è abbastanza elegante visto che in 18 righe fa tutto il necessario
-void	render_minirt(t_mlx_minirt *mlx, t_math *math)
+// a PACKET_W x PACKET_H block of the span starting at column col,
+// lanes past the end of their row are left out of the active mask
+static int	render_block(t_render *r, const t_ray_row *rows, int col,
+				t_pixel span)
 {
+	t_ray	rays[PACKET_SIZE];
+	t_hit	hits[PACKET_SIZE];
+	int		active;
+	int		lane;
+	int		count;
+
+	active = 0;
+	lane = -1;
+	while (++lane < PACKET_SIZE)
+	{
+		if (col + lane % PACKET_W < rows[lane / PACKET_W].count)
+		{
+			rays[lane] = camera_row_ray(&rows[lane / PACKET_W],
+					col + lane % PACKET_W);
+			active |= 1 << lane;
+		}
+	}
+	trace_packet(rays, active, r->math, hits);
+	count = 0;
+	lane = -1;
+	while (++lane < PACKET_SIZE)
+		if (active & (1 << lane))
+			count += shade_pixel(r, (t_pixel){span.x + col + lane % PACKET_W,
+					span.y + lane / PACKET_W}, rays[lane], &hits[lane]);
+	return (count);
+}
+
+// PACKET_H rows of up to CAMERA_ROW pixels from span, clipped to the tile:
+// the camera fills the rows by stepping along them, then they go packet
+// by packet
+static long	render_span(t_render *r, const t_tile *tile, t_pixel span)
+{
+	t_ray_row	rows[PACKET_H];
+	long		count;
+	int			i;
+
+	i = -1;
+	while (++i < PACKET_H)
+	{
+		rows[i].count = 0;
+		if (span.y + i < tile->y1)
+			camera_row(&r->math->camera, (t_pixel){span.x, span.y + i},
+				tile->x1 - span.x, &rows[i]);
+	}
+	count = 0;
+	i = 0;
+	while (i < rows[0].count)
+	{
+		count += render_block(r, rows, i, span);
+		i += PACKET_W;
+	}
+	return (count);
+}
+
+// every pixel is written by exactly one tile, no locking on the image,
+// the ray count goes to the slot of the worker once per tile
+static void	render_tile(void *ctx, const t_tile *tile, int worker)
+{
+	long	count;
 	int		y;
 	int		x;
-	t_ray	ray;
-	t_rgb	col;
 
-	y = 0;
-	while (y < IMG_HEIGHT)
+	count = 0;
+	y = tile->y0;
+	while (y < tile->y1)
 	{
-		x = 0;
-		while (x < IMG_WIDTH)
+		x = tile->x0;
+		while (x < tile->x1)
 		{
-			ray = camera_raygen(&math->camera, (t_pixel){.x = x, .y = y});
-			col = ray_cast(ray, math);
-			put_pixel(mlx, x, y, col);
-			x++;
+			count += render_span(ctx, tile, (t_pixel){x, y});
+			x += CAMERA_ROW;
 		}
-		y++;
+		y += PACKET_H;
 	}
+	((t_render *)ctx)->rays[worker].n += count;
+	stats_flush(((t_render *)ctx)->stats);
 }
 
-static void	put_pixel(t_mlx_minirt *mlx, int x, int y, t_rgb color)
+// splits the frame in tiles and lets the pool share them out,
+// if the tile list can't be allocated the frame is one big tile.
+// returns how many rays (primary and shadow) the frame took
+long	render_minirt(t_framebuffer *fb, t_math *math, const t_options *opts,
+			t_stats *stats)
 {
-	char	*dst;
+	t_render	r;
+	t_job		job;
+	t_tile		whole;
+	long		total;
+	int			i;
+
+	r = (t_render){.fb = fb, .math = math, .stats = stats};
+	job = (t_job){.run = render_tile, .ctx = &r};
+	whole = (t_tile){0, fb->y0, fb->width, fb->y0 + fb->height};
+	stage_begin(stats, STAGE_RENDER);
+	job.tiles = tiles_split(whole, opts->tile_size, &job.count);
+	if (!job.tiles)
+		render_tile(&r, &whole, 0);
+	else
+		pool_run(&job, opts->threads);
+	free(job.tiles);
+	stage_end(stats, STAGE_RENDER);
+	total = 0;
+	i = 0;
+	while (i < MAX_THREADS)
+		total += r.rays[i++].n;
+	return (total);
+}
 
-	dst = mlx->addr + (y * mlx->line_len + x * (mlx->bpp / 8));
-	*(uint32_t *)dst = color.hex;
+// returns the rays the pixel took: the primary one, plus the shadow ray
+// ray_shade casts toward the light when something was hit
+static int	shade_pixel(t_render *r, t_pixel at, const t_ray ray,
+				const t_hit *hit)
+{
+	t_vec3	color;
+
+	stat_add(STAT_PRIMARY, 1);
+	if (hit->obj != OBJ_NULL)
+		stat_add(STAT_HITS, 1);
+	color = ray_shade(ray, r->math, hit);
+	at.y -= r->fb->y0;
+	r->fb->pixels[at.y * r->fb->stride + at.x] = vec3_to_rgb(color).hex;
+	if (r->fb->hdr)
+		r->fb->hdr[at.y * r->fb->width + at.x] = color;
+	return (1 + (hit->obj != OBJ_NULL));
 }
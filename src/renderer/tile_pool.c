@@ -0,0 +1,113 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   tile_pool.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: sabruma <sabruma@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 22:22:14 by sabruma           #+#    #+#             */
+/*   Updated: 2026/10/18 01:21:08 by sabruma          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt_pool.h"
+#include "memory.h"
+
+// visits the other deques starting from the next worker,
+// so thieves spread over different victims
+static bool	pool_steal(t_pool *pool, int thief, int *tile)
+{
+	int	i;
+
+	i = 1;
+	while (i < pool->count)
+	{
+		if (deque_steal(&pool->workers[(thief + i) % pool->count].deque, tile))
+			return (true);
+		i++;
+	}
+	return (false);
+}
+
+// tiles are never added once the pool runs: when the own deque is empty
+// and nothing is left to steal the whole job is done (or being finished)
+static void	*worker_main(void *arg)
+{
+	t_worker	*self;
+	t_job		*job;
+	int			tile;
+
+	self = arg;
+	job = self->pool->job;
+	while (deque_pop(&self->deque, &tile)
+		|| pool_steal(self->pool, self->id, &tile))
+		job->run(job->ctx, &job->tiles[tile], self->id);
+	return (NULL);
+}
+
+// deals the tiles round-robin, every deque starts with a spread of the
+// whole frame so cheap and expensive regions are mixed from the beginning
+static bool	pool_init(t_pool *pool, t_job *job, int threads)
+{
+	t_worker	*w;
+	int			offset;
+	int			i;
+
+	*pool = (t_pool){.count = threads, .job = job};
+	pool->workers = ft_calloc(threads, sizeof(t_worker));
+	pool->slots = malloc(job->count * sizeof(int));
+	if (!pool->workers || !pool->slots)
+		return (free(pool->workers), free(pool->slots), false);
+	offset = 0;
+	i = -1;
+	while (++i < threads)
+	{
+		w = &pool->workers[i];
+		*w = (t_worker){.pool = pool, .id = i};
+		w->deque.items = pool->slots + offset;
+		offset += deque_fill(&w->deque, i, threads, job->count);
+		pthread_mutex_init(&w->deque.lock, NULL);
+	}
+	return (true);
+}
+
+static void	pool_release(t_pool *pool)
+{
+	int	i;
+
+	i = 0;
+	while (i < pool->count)
+		pthread_mutex_destroy(&pool->workers[i++].deque.lock);
+	free(pool->workers);
+	free(pool->slots);
+}
+
+// the calling thread works as worker 0, so a worker that can't be spawned
+// only costs parallelism: its tiles get stolen by the others.
+// without memory for the deques the whole job runs serially
+void	pool_run(t_job *job, int threads)
+{
+	t_pool	pool;
+	int		i;
+
+	if (threads > job->count)
+		threads = job->count;
+	if (threads < 1)
+		threads = 1;
+	if (!pool_init(&pool, job, threads))
+	{
+		i = 0;
+		while (i < job->count)
+			job->run(job->ctx, &job->tiles[i++], 0);
+		return ;
+	}
+	i = 0;
+	while (++i < threads)
+		pool.workers[i].started = !pthread_create(&pool.workers[i].thread,
+				NULL, worker_main, &pool.workers[i]);
+	worker_main(&pool.workers[0]);
+	while (--i > 0)
+		if (pool.workers[i].started)
+			pthread_join(pool.workers[i].thread, NULL);
+	pool_release(&pool);
+}
@@ -0,0 +1,54 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   tiles.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: sabruma <sabruma@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 22:22:06 by sabruma           #+#    #+#             */
+/*   Updated: 2026/10/18 01:21:08 by sabruma          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt_pool.h"
+#include <limits.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+static int	imin(int a, int b)
+{
+	if (a < b)
+		return (a);
+	return (b);
+}
+
+// cuts the area (a whole frame or a strip of it) in row-major square
+// tiles of side `size`, the last column and row are clipped to its borders.
+// NULL when there would be more than INT_MAX tiles, like a failed malloc
+t_tile	*tiles_split(t_tile area, int size, int *count)
+{
+	t_tile	*tiles;
+	size_t	cols;
+	size_t	n;
+	int		i;
+
+	*count = 0;
+	cols = ((size_t)(area.x1 - area.x0) + size - 1) / size;
+	n = cols * (((size_t)(area.y1 - area.y0) + size - 1) / size);
+	if (n > INT_MAX || n > SIZE_MAX / sizeof(t_tile))
+		return (NULL);
+	tiles = malloc(n * sizeof(t_tile));
+	if (!tiles)
+		return (NULL);
+	*count = (int)n;
+	i = 0;
+	while (i < *count)
+	{
+		tiles[i].x0 = area.x0 + (int)(i % cols) * size;
+		tiles[i].y0 = area.y0 + (int)(i / cols) * size;
+		tiles[i].x1 = imin(tiles[i].x0 + size, area.x1);
+		tiles[i].y1 = imin(tiles[i].y0 + size, area.y1);
+		i++;
+	}
+	return (tiles);
+}
@@ -6,83 +6,72 @@
 /*   By: sabruma <sabruma@student.42firenze.it>     +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2026/03/18 10:21:27 by sabruma           #+#    #+#             */
-/*   Updated: 2026/03/23 00:44:15 by sabruma          ###   ########.fr       */
+/*   Updated: 2026/10/18 00:03:42 by sabruma          ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "minirt_renderer.h"
 
-void	loop_sp(const t_ray ray, const t_math *math, t_hit *near, int *idx);
-void	loop_pl(const t_ray ray, const t_math *math, t_hit *near, int *idx);
-void	loop_cy(const t_ray ray, const t_math *math, t_hit *near, int *idx);
-
-// function that calls for each object type its own intersect function
-// returns true if the intersection is found
-// idx then holds the index of the array member of t_math
-// the specific array is identified by near->obj enum entry
-// there's a triple loop leading to future multithreading optimizations,
-// where each thread could loop on each geometry type safely
-
-bool	trace(const t_ray ray, const t_math *math, t_hit *near, int *idx)
-{
-	near->obj = OBJ_NULL;
-	near->t = INFINITY;
-	loop_sp(ray, math, near, idx);
-	loop_pl(ray, math, near, idx);
-	loop_cy(ray, math, near, idx);
-	return (near->obj != OBJ_NULL);
-}
-
-// loops over spheres
-void	loop_sp(const t_ray ray, const t_math *math, t_hit *near, int *idx)
+// loops over planes
+static void	loop_pl(t_trace *tr)
 {
+	float	t;
 	int		i;
-	t_hit	hit;
 
+	stat_add(STAT_PLANE, tr->math->pl_count);
 	i = 0;
-	while (i < math->sp_count)
+	while (i < tr->math->pl_count)
 	{
-		hit.t = INFINITY;
-		if (sphere_intersect(&math->spheres[i++], ray, &hit) && hit.t < near->t)
+		if (plane_intersect_t(&tr->math->planes[i], &tr->ray, &t)
+			&& t < tr->best_t)
 		{
-			*near = hit;
-			*idx = i;
+			tr->best_t = t;
+			tr->ray.t_max = t;
+			tr->best = (t_bvh_ref){.obj = OBJ_PLANE, .idx = i};
 		}
+		i++;
 	}
 }
 
-// loops over planes
-void	loop_pl(const t_ray ray, const t_math *math, t_hit *near, int *idx)
+// function that calls for each object type its own intersect function
+// returns true if the intersection is found
+// idx then holds the index of the array member of t_math
+// the specific array is identified by near->obj enum entry
+// spheres and cylinders go through the BVH, the planes are unbounded
+// and stay a flat loop. The loops only compare distances, near is filled
+// once for the winner (with the original ray, t_max is narrowed meanwhile)
+// it only reads t_math, so the render workers can call it concurrently
+bool	trace(const t_ray ray, const t_math *math, t_hit *near, int *idx)
 {
-	int		i;
-	t_hit	hit;
+	t_trace	tr;
 
-	i = 0;
-	while (i < math->pl_count)
-	{
-		hit.t = INFINITY;
-		if (plane_intersect(&math->planes[i++], ray, &hit) && hit.t < near->t)
-		{
-			*near = hit;
-			*idx = i;
-		}
-	}
+	tr.ray = ray;
+	tr.math = math;
+	tr.best = (t_bvh_ref){.obj = OBJ_NULL, .idx = -1};
+	tr.best_t = INFINITY;
+	loop_bvh(&tr);
+	loop_pl(&tr);
+	*idx = tr.best.idx;
+	near->t = tr.best_t;
+	hit_finalize(math, &ray, tr.best, near);
+	return (near->obj != OBJ_NULL);
 }
 
-// loops over cylinders
-void	loop_cy(const t_ray ray, const t_math *math, t_hit *near, int *idx)
+// second phase of a closest-hit query, near->t holds the distance of best.
+// without a winner near stays empty (OBJ_NULL, t = inf)
+void	hit_finalize(const t_math *math, const t_ray *ray, t_bvh_ref best,
+			t_hit *near)
 {
-	int		i;
-	t_hit	hit;
+	float	t;
 
-	i = 0;
-	while (i < math->cy_count)
-	{
-		hit.t = INFINITY;
-		if (cylinder_intersect(&math->cys[i++], ray, &hit) && hit.t < near->t)
-		{
-			*near = hit;
-			*idx = i;
-		}
-	}
+	t = near->t;
+	near->obj = OBJ_NULL;
+	if (best.obj == OBJ_SPHERE)
+		sphere_soa_finalize(&math->sp_soa, best.idx, ray, near);
+	else if (best.obj == OBJ_PLANE)
+		plane_finalize(&math->planes[best.idx], ray, t, near);
+	else if (best.obj == OBJ_CYLINDER)
+		cylinder_finalize(&math->cys[best.idx], ray, t, near);
+	else
+		near->t = INFINITY;
 }
@@ -0,0 +1,113 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   trace_bvh.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: sabruma <sabruma@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 22:27:58 by sabruma           #+#    #+#             */
+/*   Updated: 2026/10/18 00:03:42 by sabruma          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt_renderer.h"
+
+static void	push(t_trace *tr, int node, float t_near)
+{
+	tr->stack[tr->top] = node;
+	tr->entry[tr->top] = t_near;
+	tr->top++;
+}
+
+// the nearer child is pushed last so it is popped first,
+// children entering past the closest hit so far are dropped
+static void	visit_children(t_trace *tr, const t_bvh_node *node)
+{
+	const t_bvh_node	*kids;
+	float				t[2];
+	bool				hit[2];
+
+	stat_add(STAT_AABB, 2);
+	kids = tr->math->bvh.nodes + node->first;
+	hit[0] = aabb_intersect(&kids[0].box, &tr->ray, tr->inv_dir, &t[0])
+		&& t[0] <= tr->best_t;
+	hit[1] = aabb_intersect(&kids[1].box, &tr->ray, tr->inv_dir, &t[1])
+		&& t[1] <= tr->best_t;
+	if (hit[0] && hit[1] && t[0] < t[1])
+	{
+		push(tr, node->first + 1, t[1]);
+		push(tr, node->first, t[0]);
+	}
+	else if (hit[0] && hit[1])
+	{
+		push(tr, node->first, t[0]);
+		push(tr, node->first + 1, t[1]);
+	}
+	else if (hit[0])
+		push(tr, node->first, t[0]);
+	else if (hit[1])
+		push(tr, node->first + 1, t[1]);
+}
+
+// the tests hit_leaf makes: the whole sphere range, then each cylinder
+static void	count_leaf(const t_bvh_node *node, const int *range)
+{
+	stat_add(STAT_SPHERE, range[1]);
+	stat_add(STAT_CYLINDER, node->count - range[1]);
+}
+
+// first phase only: t-only tests, the winner is finalized by trace.
+// the leaf's spheres go through the batch kernel in one call
+static void	hit_leaf(t_trace *tr, const t_bvh_node *node)
+{
+	const t_bvh_ref	*ref;
+	int				range[2];
+	int				i;
+	float			t;
+
+	leaf_spheres(tr->math, node, range);
+	count_leaf(node, range);
+	i = sphere_intersect_n(&tr->math->sp_soa, &tr->ray, range, &tr->best_t);
+	if (i >= 0)
+	{
+		tr->ray.t_max = tr->best_t;
+		tr->best = (t_bvh_ref){.obj = OBJ_SPHERE, .idx = i};
+	}
+	ref = tr->math->bvh.refs + node->first + range[1];
+	while (ref < tr->math->bvh.refs + node->first + node->count)
+	{
+		if (cylinder_intersect_t(&tr->math->cys[ref->idx], &tr->ray, &t)
+			&& t < tr->best_t)
+		{
+			tr->best_t = t;
+			tr->ray.t_max = t;
+			tr->best = *ref;
+		}
+		ref++;
+	}
+}
+
+// closest hit among spheres and cylinders through the BVH,
+// a node is skipped when the closest hit was found before its entry point
+void	loop_bvh(t_trace *tr)
+{
+	const t_bvh_node	*node;
+	float				t;
+
+	if (tr->math->bvh.node_count == 0)
+		return ;
+	tr->inv_dir = vec3_div_comp(vec3_one(), tr->ray.direction);
+	tr->top = 0;
+	stat_add(STAT_AABB, 1);
+	if (aabb_intersect(&tr->math->bvh.nodes[0].box, &tr->ray, tr->inv_dir, &t))
+		push(tr, 0, t);
+	while (tr->top > 0)
+	{
+		tr->top--;
+		node = &tr->math->bvh.nodes[tr->stack[tr->top]];
+		if (tr->entry[tr->top] <= tr->best_t && node->count)
+			hit_leaf(tr, node);
+		else if (tr->entry[tr->top] <= tr->best_t)
+			visit_children(tr, node);
+	}
+}
@@ -0,0 +1,81 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   trace_occluded.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: sabruma <sabruma@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 22:35:55 by sabruma           #+#    #+#             */
+/*   Updated: 2026/10/18 00:03:42 by sabruma          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt_renderer.h"
+
+static bool	leaf_occluded(const t_ray *ray, const t_math *math,
+				const t_bvh_node *node)
+{
+	const t_bvh_ref	*ref;
+	int				range[2];
+	float			t;
+
+	leaf_spheres(math, node, range);
+	stat_add(STAT_SPHERE, range[1]);
+	t = INFINITY;
+	if (sphere_intersect_n(&math->sp_soa, ray, range, &t) >= 0)
+		return (true);
+	ref = math->bvh.refs + node->first + range[1];
+	while (ref < math->bvh.refs + node->first + node->count)
+	{
+		stat_add(STAT_CYLINDER, 1);
+		if (cylinder_intersect_t(&math->cys[ref->idx], ray, &t))
+			return (true);
+		ref++;
+	}
+	return (false);
+}
+
+// any order is fine for an any-hit query: no sorting, first blocker wins
+static bool	bvh_occluded(const t_ray *ray, const t_math *math)
+{
+	int					stack[BVH_STACK];
+	int					top;
+	const t_bvh_node	*node;
+	t_vec3				inv_dir;
+	float				t;
+
+	inv_dir = vec3_div_comp(vec3_one(), ray->direction);
+	stack[0] = 0;
+	top = (math->bvh.node_count != 0);
+	while (top > 0)
+	{
+		node = &math->bvh.nodes[stack[--top]];
+		stat_add(STAT_AABB, 1);
+		if (aabb_intersect(&node->box, ray, inv_dir, &t))
+		{
+			if (node->count && leaf_occluded(ray, math, node))
+				return (true);
+			if (!node->count)
+			{
+				stack[top++] = node->first;
+				stack[top++] = node->first + 1;
+			}
+		}
+	}
+	return (false);
+}
+
+// true if anything lies on the ray inside [t_min, t_max):
+// shadow rays set t_max to the light distance and never build a t_hit
+bool	trace_occluded(const t_ray ray, const t_math *math)
+{
+	float	t;
+	int		i;
+
+	stat_add(STAT_PLANE, math->pl_count);
+	i = 0;
+	while (i < math->pl_count)
+		if (plane_intersect_t(&math->planes[i++], &ray, &t))
+			return (true);
+	return (bvh_occluded(&ray, math));
+}
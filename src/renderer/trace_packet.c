@@ -0,0 +1,79 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   trace_packet.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: sabruma <sabruma@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 22:49:30 by sabruma           #+#    #+#             */
+/*   Updated: 2026/10/18 00:03:42 by sabruma          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt_renderer.h"
+
+// every active lane must point the same way on each axis: the children
+// are then entered in the same order by all of them, otherwise the packet
+// would drag each lane down the paths of the others
+static bool	packet_coherent(const t_ray *rays, int active)
+{
+	t_vec3	d;
+	int		first;
+	int		lane;
+
+	first = __builtin_ctz(active);
+	d = rays[first].direction;
+	lane = first;
+	while (++lane < PACKET_SIZE)
+	{
+		if ((active & (1 << lane))
+			&& ((rays[lane].direction.x < 0) != (d.x < 0)
+				|| (rays[lane].direction.y < 0) != (d.y < 0)
+				|| (rays[lane].direction.z < 0) != (d.z < 0)))
+			return (false);
+	}
+	return (true);
+}
+
+// the fallback for packets that diverge: one trace per active lane
+static void	trace_lanes(const t_ray *rays, int active, const t_math *math,
+				t_hit *hits)
+{
+	int	lane;
+	int	idx;
+
+	lane = -1;
+	while (++lane < PACKET_SIZE)
+		if (active & (1 << lane))
+			trace(rays[lane], math, &hits[lane], &idx);
+}
+
+// trace() for the rays of the lanes set in active, hits[lane] gets
+// the same hit trace would give. the rays share a single walk down
+// the BVH and the spheres and planes test all lanes at once
+void	trace_packet(const t_ray *rays, int active, const t_math *math,
+			t_hit *hits)
+{
+	t_packet_trace	pt;
+	int				lane;
+
+	if (!active)
+		return ;
+	if (!packet_coherent(rays, active))
+		return (trace_lanes(rays, active, math, hits));
+	packet_init(&pt.p, rays, active);
+	pt.math = math;
+	pt.lanes = __builtin_popcount(active);
+	lane = -1;
+	while (++lane < PACKET_SIZE)
+		pt.best[lane] = (t_bvh_ref){.obj = OBJ_NULL, .idx = -1};
+	loop_packet_bvh(&pt);
+	packet_planes(&pt);
+	lane = -1;
+	while (++lane < PACKET_SIZE)
+	{
+		hits[lane].t = pt.p.best[lane];
+		if (active & (1 << lane))
+			hit_finalize(math, &rays[lane], pt.best[lane], &hits[lane]);
+	}
+}
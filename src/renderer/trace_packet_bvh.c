@@ -0,0 +1,114 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   trace_packet_bvh.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: sabruma <sabruma@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 22:49:44 by sabruma           #+#    #+#             */
+/*   Updated: 2026/10/18 00:03:42 by sabruma          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt_renderer.h"
+
+static void	push(t_packet_trace *pt, int node, float t_near, int mask)
+{
+	pt->stack[pt->top] = node;
+	pt->entry[pt->top] = t_near;
+	pt->mask[pt->top] = mask;
+	pt->top++;
+}
+
+// farthest closest hit among the lanes in mask: a node entered
+// past it can't improve any of them
+static float	packet_far(const t_packet_trace *pt, int mask)
+{
+	float	far;
+	int		lane;
+
+	far = -INFINITY;
+	while (mask)
+	{
+		lane = __builtin_ctz(mask);
+		if (pt->p.best[lane] > far)
+			far = pt->p.best[lane];
+		mask &= mask - 1;
+	}
+	return (far);
+}
+
+// visit_children for a packet, each child keeps the lanes that enter it
+static void	packet_children(t_packet_trace *pt, const t_bvh_node *node)
+{
+	const t_bvh_node	*kids;
+	float				t[2];
+	int					hit[2];
+
+	stat_add(STAT_AABB, 2 * pt->lanes);
+	kids = pt->math->bvh.nodes + node->first;
+	hit[0] = packet_aabb(&kids[0].box, &pt->p, &t[0]);
+	hit[1] = packet_aabb(&kids[1].box, &pt->p, &t[1]);
+	if (hit[0] && hit[1] && t[0] < t[1])
+	{
+		push(pt, node->first + 1, t[1], hit[1]);
+		push(pt, node->first, t[0], hit[0]);
+	}
+	else if (hit[0] && hit[1])
+	{
+		push(pt, node->first, t[0], hit[0]);
+		push(pt, node->first + 1, t[1], hit[1]);
+	}
+	else if (hit[0])
+		push(pt, node->first, t[0], hit[0]);
+	else if (hit[1])
+		push(pt, node->first + 1, t[1], hit[1]);
+}
+
+// spheres through the packet kernel, cylinders lane by lane
+static void	packet_leaf(t_packet_trace *pt, const t_bvh_node *node, int mask)
+{
+	const t_bvh_ref	*ref;
+	int				range[2];
+	int				i;
+
+	leaf_spheres(pt->math, node, range);
+	stat_add(STAT_SPHERE, range[1] * pt->lanes);
+	i = range[0];
+	while (i < range[0] + range[1])
+	{
+		packet_record(pt, sphere_packet(&pt->math->sp_soa, i, &pt->p),
+			(t_bvh_ref){.obj = OBJ_SPHERE, .idx = i});
+		i++;
+	}
+	ref = pt->math->bvh.refs + node->first + range[1];
+	while (ref < pt->math->bvh.refs + node->first + node->count)
+		packet_cylinder(pt, ref++, mask);
+}
+
+// loop_bvh for a packet: one walk for all lanes, a node is skipped once
+// every lane that entered it has a closer hit
+void	loop_packet_bvh(t_packet_trace *pt)
+{
+	const t_bvh_node	*node;
+	float				t;
+	int					mask;
+
+	if (pt->math->bvh.node_count == 0)
+		return ;
+	pt->top = 0;
+	stat_add(STAT_AABB, pt->lanes);
+	mask = packet_aabb(&pt->math->bvh.nodes[0].box, &pt->p, &t);
+	if (mask)
+		push(pt, 0, t, mask);
+	while (pt->top > 0)
+	{
+		pt->top--;
+		node = &pt->math->bvh.nodes[pt->stack[pt->top]];
+		mask = pt->mask[pt->top];
+		if (pt->entry[pt->top] <= packet_far(pt, mask) && node->count)
+			packet_leaf(pt, node, mask);
+		else if (pt->entry[pt->top] <= packet_far(pt, mask))
+			packet_children(pt, node);
+	}
+}
@@ -0,0 +1,61 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   trace_packet_prims.c                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: sabruma <sabruma@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 22:49:44 by sabruma           #+#    #+#             */
+/*   Updated: 2026/10/18 00:03:42 by sabruma          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt_renderer.h"
+
+// lanes now closest to ref
+void	packet_record(t_packet_trace *pt, int lanes, t_bvh_ref ref)
+{
+	while (lanes)
+	{
+		pt->best[__builtin_ctz(lanes)] = ref;
+		lanes &= lanes - 1;
+	}
+}
+
+// cylinders have no packet kernel: the scalar test on each lane
+// that reached the leaf, against its narrowed ray
+void	packet_cylinder(t_packet_trace *pt, const t_bvh_ref *ref, int lanes)
+{
+	t_ray	ray;
+	float	t;
+	int		lane;
+
+	while (lanes)
+	{
+		lane = __builtin_ctz(lanes);
+		stat_add(STAT_CYLINDER, 1);
+		ray = packet_ray(&pt->p, lane);
+		if (cylinder_intersect_t(&pt->math->cys[ref->idx], &ray, &t)
+			&& t < pt->p.best[lane])
+		{
+			packet_hit(&pt->p, lane, t);
+			pt->best[lane] = *ref;
+		}
+		lanes &= lanes - 1;
+	}
+}
+
+// loop_pl for a packet
+void	packet_planes(t_packet_trace *pt)
+{
+	int	i;
+
+	stat_add(STAT_PLANE, pt->math->pl_count * pt->lanes);
+	i = 0;
+	while (i < pt->math->pl_count)
+	{
+		packet_record(pt, plane_packet(&pt->math->planes[i], &pt->p),
+			(t_bvh_ref){.obj = OBJ_PLANE, .idx = i});
+		i++;
+	}
+}
@@ -0,0 +1,76 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   rtb_check.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: sabruma <sabruma@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:21:51 by sabruma           #+#    #+#             */
+/*   Updated: 2026/10/17 23:21:51 by sabruma          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt_scene.h"
+#include <string.h>
+
+static const uint64_t	g_item_size[RTB_SECTIONS] = {
+	sizeof(t_sphere_math),
+	sizeof(t_plane_math),
+	sizeof(t_cylinder_math),
+	sizeof(t_bvh_node),
+	sizeof(t_bvh_ref),
+	sizeof(float),
+	sizeof(t_vec3)
+};
+
+// every section aligned, inside the file and made of records of the
+// size this build uses; the counts have to fit the int fields of t_math
+static const char	*check_spans(const t_rtb_header *h, size_t size)
+{
+	const t_rtb_span	*s;
+	int					i;
+
+	i = -1;
+	while (++i < RTB_SECTIONS)
+	{
+		s = &h->spans[i];
+		if (s->item_size != g_item_size[i])
+			return ("written by a build with a different layout");
+		if (s->offset % RTB_ALIGN || s->offset < sizeof(*h) || s->offset > size
+			|| s->count > (size - s->offset) / s->item_size
+			|| s->count > INT32_MAX)
+			return ("corrupted section table");
+	}
+	if (h->spans[RTB_SOA].count != 4 * h->soa_stride
+		|| h->soa_stride < h->spans[RTB_SPHERES].count + SPHERE_SOA_PAD
+		|| h->spans[RTB_SOA_COLORS].count != h->spans[RTB_SPHERES].count)
+		return ("corrupted section table");
+	return (NULL);
+}
+
+// NULL when the mapped file can be used as it is, otherwise why not.
+// past the checksum the contents (BVH indices and so on) are trusted
+const char	*rtb_verify(const t_rtb_header *h, size_t size)
+{
+	const void	*ptr[RTB_SECTIONS];
+	const char	*err;
+	int			i;
+
+	if (size < sizeof(*h) || memcmp(h->magic, RTB_MAGIC, sizeof(h->magic)))
+		return ("not a .rtb file");
+	if (h->byte_order != RTB_BYTE_ORDER)
+		return ("written on a machine with a different byte order");
+	if (h->version != RTB_VERSION || h->header_size != sizeof(*h))
+		return ("written by another version");
+	if (h->file_size != size)
+		return ("truncated or padded file");
+	err = check_spans(h, size);
+	if (err)
+		return (err);
+	i = -1;
+	while (++i < RTB_SECTIONS)
+		ptr[i] = (const char *)h + h->spans[i].offset;
+	if (rtb_checksum(h, ptr) != h->checksum)
+		return ("checksum mismatch");
+	return (NULL);
+}
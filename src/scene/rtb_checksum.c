@@ -0,0 +1,73 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   rtb_checksum.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: sabruma <sabruma@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:20:59 by sabruma           #+#    #+#             */
+/*   Updated: 2026/10/17 23:20:59 by sabruma          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt_scene.h"
+#include <string.h>
+
+#define PRIME_1 0x9E3779B185EBCA87ULL
+#define PRIME_2 0xC2B2AE3D27D4EB4FULL
+
+static uint64_t	mix(uint64_t acc, uint64_t word)
+{
+	acc += word * PRIME_2;
+	acc = (acc << 31) | (acc >> 33);
+	return (acc * PRIME_1);
+}
+
+// xxhash style: four independent lanes over 32 byte blocks keep the
+// multipliers busy, so checking a big scene costs about a memory pass
+static uint64_t	hash_block(const unsigned char *p, size_t size, uint64_t seed)
+{
+	uint64_t	lane[4];
+	uint64_t	w[4];
+	size_t		i;
+
+	lane[0] = seed + PRIME_1;
+	lane[1] = seed ^ PRIME_2;
+	lane[2] = seed;
+	lane[3] = seed - PRIME_1;
+	i = 0;
+	while (i + sizeof(w) <= size)
+	{
+		memcpy(w, p + i, sizeof(w));
+		lane[0] = mix(lane[0], w[0]);
+		lane[1] = mix(lane[1], w[1]);
+		lane[2] = mix(lane[2], w[2]);
+		lane[3] = mix(lane[3], w[3]);
+		i += sizeof(w);
+	}
+	seed = mix(mix(mix(mix(size, lane[0]), lane[1]), lane[2]), lane[3]);
+	while (i < size)
+		seed = mix(seed, p[i++]);
+	return (seed);
+}
+
+// the header is hashed with its checksum field zeroed, then every
+// section in order, each seeded with the hash so far
+uint64_t	rtb_checksum(const t_rtb_header *h, const void **sections)
+{
+	t_rtb_header	copy;
+	uint64_t		sum;
+	int				i;
+
+	memcpy(&copy, h, sizeof(copy));
+	copy.checksum = 0;
+	sum = hash_block((const unsigned char *)&copy, sizeof(copy), 0);
+	i = 0;
+	while (i < RTB_SECTIONS)
+	{
+		sum = hash_block(sections[i], h->spans[i].count * h->spans[i].item_size,
+				sum);
+		i++;
+	}
+	return (sum);
+}
@@ -0,0 +1,122 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   rtb_export.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: sabruma <sabruma@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:21:51 by sabruma           #+#    #+#             */
+/*   Updated: 2026/10/17 23:21:51 by sabruma          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt_scene.h"
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+static const char	g_zeros[RTB_ALIGN];
+
+// every array of the t_math with its record count and size
+static void	rtb_sections(const t_math *m, const void **ptr, t_rtb_span *s)
+{
+	ptr[RTB_SPHERES] = m->spheres;
+	s[RTB_SPHERES] = (t_rtb_span){0, m->sp_count, sizeof(t_sphere_math)};
+	ptr[RTB_PLANES] = m->planes;
+	s[RTB_PLANES] = (t_rtb_span){0, m->pl_count, sizeof(t_plane_math)};
+	ptr[RTB_CYLINDERS] = m->cys;
+	s[RTB_CYLINDERS] = (t_rtb_span){0, m->cy_count, sizeof(t_cylinder_math)};
+	ptr[RTB_BVH_NODES] = m->bvh.nodes;
+	s[RTB_BVH_NODES] = (t_rtb_span){0, m->bvh.node_count, sizeof(t_bvh_node)};
+	ptr[RTB_BVH_REFS] = m->bvh.refs;
+	s[RTB_BVH_REFS] = (t_rtb_span){0, m->bvh.ref_count, sizeof(t_bvh_ref)};
+	ptr[RTB_SOA] = m->sp_soa.x;
+	s[RTB_SOA] = (t_rtb_span){0, 4 * (m->sp_soa.y - m->sp_soa.x),
+		sizeof(float)};
+	ptr[RTB_SOA_COLORS] = m->sp_soa.color;
+	s[RTB_SOA_COLORS] = (t_rtb_span){0, m->sp_count, sizeof(t_vec3)};
+}
+
+static void	rtb_layout(const t_math *m, t_rtb_header *h, const void **ptr)
+{
+	uint64_t	offset;
+	int			i;
+
+	memset(h, 0, sizeof(*h));
+	memcpy(h->magic, RTB_MAGIC, sizeof(h->magic));
+	h->byte_order = RTB_BYTE_ORDER;
+	h->version = RTB_VERSION;
+	h->header_size = sizeof(*h);
+	h->soa_stride = m->sp_soa.y - m->sp_soa.x;
+	h->ambient = m->ambient;
+	h->camera = m->camera;
+	h->light = m->light;
+	rtb_sections(m, ptr, h->spans);
+	offset = sizeof(*h);
+	i = -1;
+	while (++i < RTB_SECTIONS)
+	{
+		offset = (offset + RTB_ALIGN - 1) / RTB_ALIGN * RTB_ALIGN;
+		h->spans[i].offset = offset;
+		offset += h->spans[i].count * h->spans[i].item_size;
+	}
+	h->file_size = offset;
+	h->checksum = rtb_checksum(h, ptr);
+}
+
+static int	write_all(int fd, const void *buf, size_t size)
+{
+	ssize_t	n;
+
+	while (size > 0)
+	{
+		n = write(fd, buf, size);
+		if (n <= 0)
+			return (1);
+		buf = (const char *)buf + n;
+		size -= n;
+	}
+	return (0);
+}
+
+// header, then zeros up to each section and the section itself
+static int	write_sections(int fd, const t_rtb_header *h, const void **ptr)
+{
+	uint64_t	at;
+	int			i;
+
+	if (write_all(fd, h, sizeof(*h)))
+		return (1);
+	at = sizeof(*h);
+	i = -1;
+	while (++i < RTB_SECTIONS)
+	{
+		if (write_all(fd, g_zeros, h->spans[i].offset - at))
+			return (1);
+		at = h->spans[i].offset + h->spans[i].count * h->spans[i].item_size;
+		if (write_all(fd, ptr[i], at - h->spans[i].offset))
+			return (1);
+	}
+	return (0);
+}
+
+// --export-binary: the scene as init_math built it, see minirt_scene.h
+int	rtb_export(const t_math *m, const char *path)
+{
+	t_rtb_header	h;
+	const void		*ptr[RTB_SECTIONS];
+	int				fd;
+	int				err;
+
+	rtb_layout(m, &h, ptr);
+	fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+	if (fd < 0)
+		return (printf("Output error: cannot write %s\n", path), 1);
+	err = write_sections(fd, &h, ptr);
+	if (close(fd) < 0 || err)
+		return (printf("Output error: cannot write %s\n", path), 1);
+	printf("Exported %s (%llu bytes)\n", path,
+		(unsigned long long)h.file_size);
+	return (0);
+}
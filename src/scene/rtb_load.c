@@ -0,0 +1,110 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   rtb_load.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: sabruma <sabruma@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:21:51 by sabruma           #+#    #+#             */
+/*   Updated: 2026/10/18 01:00:36 by sabruma          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt_scene.h"
+#include "memory.h"
+#include <fcntl.h>
+#include <stdio.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// read only and populated up front: the checksum reads every page anyway.
+// an empty file isn't mapped, *h stays NULL and rtb_verify refuses it
+// on the size. 1 (error printed) if the file can't be opened or mapped
+static int	rtb_map(const char *path, const t_rtb_header **h, size_t *size)
+{
+	struct stat	st;
+	void		*map;
+	int			fd;
+
+	*h = NULL;
+	*size = 0;
+	fd = open(path, O_RDONLY);
+	if (fd < 0 || fstat(fd, &st) < 0)
+	{
+		if (fd >= 0)
+			close(fd);
+		return (printf("Error: %s does not exist or cannot access\n", path), 1);
+	}
+	map = NULL;
+	if (st.st_size > 0)
+		map = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE | MAP_POPULATE,
+				fd, 0);
+	close(fd);
+	if (map == MAP_FAILED)
+		return (printf("Error: %s: cannot be mapped\n", path), 1);
+	*h = map;
+	*size = st.st_size;
+	return (0);
+}
+
+static const void	*at(const t_rtb_header *h, t_rtb_section section)
+{
+	return ((const char *)h + h->spans[section].offset);
+}
+
+// the arrays stay in the mapping, destroy_math unmaps it
+static t_math	*rtb_attach(const t_rtb_header *h, size_t size)
+{
+	t_math	*m;
+	float	*soa;
+
+	m = ft_calloc(1, sizeof(t_math));
+	if (!m)
+		return (NULL);
+	m->ambient = h->ambient;
+	m->camera = h->camera;
+	m->light = h->light;
+	m->spheres = (t_sphere_math *)at(h, RTB_SPHERES);
+	m->planes = (t_plane_math *)at(h, RTB_PLANES);
+	m->cys = (t_cylinder_math *)at(h, RTB_CYLINDERS);
+	m->sp_count = h->spans[RTB_SPHERES].count;
+	m->pl_count = h->spans[RTB_PLANES].count;
+	m->cy_count = h->spans[RTB_CYLINDERS].count;
+	m->bvh = (t_bvh){(t_bvh_node *)at(h, RTB_BVH_NODES),
+		(t_bvh_ref *)at(h, RTB_BVH_REFS), h->spans[RTB_BVH_NODES].count,
+		h->spans[RTB_BVH_REFS].count};
+	soa = (float *)at(h, RTB_SOA);
+	m->sp_soa = (t_sphere_soa){soa, soa + h->soa_stride,
+		soa + 2 * h->soa_stride, soa + 3 * h->soa_stride,
+		(t_vec3 *)at(h, RTB_SOA_COLORS), m->sp_count};
+	m->mapping = (void *)h;
+	m->mapping_size = size;
+	return (m);
+}
+
+t_math	*rtb_load(const char *path)
+{
+	const t_rtb_header	*h;
+	const char			*err;
+	size_t				size;
+	t_math				*m;
+
+	if (rtb_map(path, &h, &size))
+		return (NULL);
+	err = rtb_verify(h, size);
+	if (err)
+	{
+		printf("Error: %s: %s\n", path, err);
+		if (h)
+			munmap((void *)h, size);
+		return (NULL);
+	}
+	m = rtb_attach(h, size);
+	if (!m)
+	{
+		printf("Malloc error: failed to initialize math engine\n");
+		munmap((void *)h, size);
+	}
+	return (m);
+}
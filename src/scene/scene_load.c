@@ -0,0 +1,63 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   scene_load.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: sabruma <sabruma@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:21:51 by sabruma           #+#    #+#             */
+/*   Updated: 2026/10/18 00:03:42 by sabruma          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt.h"
+#include "minirt_output.h"
+#include "minirt_scene.h"
+
+static bool	is_rtb(const char *path)
+{
+	size_t	len;
+
+	len = ft_strlen(path);
+	return (len > 4 && ft_strcmp(path + len - 4, ".rtb") == 0);
+}
+
+static t_math	*load_text(const char *path, int threads, t_stats *stats)
+{
+	t_element	*elements;
+	t_math		*m;
+
+	stage_begin(stats, STAGE_LOAD);
+	elements = parse_input(path, threads);
+	stage_end(stats, STAGE_LOAD);
+	if (!elements)
+	{
+		printf("Parsing error: invalid file data");
+		return (NULL);
+	}
+	printf("Parsing successful!\n");
+	stage_begin(stats, STAGE_BUILD);
+	m = init_math(elements);
+	stage_end(stats, STAGE_BUILD);
+	free(elements);
+	if (!m)
+		printf("Malloc error: failed to initialize math engine\n");
+	return (m);
+}
+
+t_math	*load_scene(const t_options *opts, t_stats *stats)
+{
+	t_math	*m;
+
+	if (!is_rtb(opts->scene))
+		m = load_text(opts->scene, opts->threads, stats);
+	else
+	{
+		stage_begin(stats, STAGE_LOAD);
+		m = rtb_load(opts->scene);
+		stage_end(stats, STAGE_LOAD);
+	}
+	if (m)
+		camera_resize(&m->camera, opts->width, opts->height);
+	return (m);
+}
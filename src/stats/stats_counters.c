@@ -0,0 +1,45 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   stats_counters.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: sabruma <sabruma@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:59:32 by sabruma           #+#    #+#             */
+/*   Updated: 2026/10/17 23:59:32 by sabruma          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt_stats.h"
+
+// only built with make STATS=1. every render worker counts into its
+// own block, no sharing until the end of a tile
+static t_stats	*stats_local(void)
+{
+	static _Thread_local t_stats	local;
+
+	return (&local);
+}
+
+void	stat_add(t_counter counter, long n)
+{
+	stats_local()->count[counter] += n;
+}
+
+// the workers flush concurrently into the same totals, once per tile.
+// without totals (a warm-up frame) the counts are just dropped
+void	stats_flush(t_stats *dst)
+{
+	t_stats	*local;
+	int		i;
+
+	local = stats_local();
+	i = -1;
+	while (++i < COUNTERS)
+	{
+		if (dst)
+			__atomic_fetch_add(&dst->count[i], local->count[i],
+				__ATOMIC_RELAXED);
+		local->count[i] = 0;
+	}
+}
@@ -0,0 +1,105 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   stats_report.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: sabruma <sabruma@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:59:41 by sabruma           #+#    #+#             */
+/*   Updated: 2026/10/17 23:59:41 by sabruma          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt_stats.h"
+#include <fcntl.h>
+#include <stdio.h>
+#include <unistd.h>
+
+static const char	*g_stage_names[STAGES] = {
+	"load", "build", "render", "write"
+};
+
+static const char	*g_counter_names[COUNTERS] = {
+	"primary_rays", "shadow_rays", "hits", "shadow_occluded",
+	"aabb_tests", "sphere_tests", "plane_tests", "cylinder_tests"
+};
+
+// per primary ray puts scenes of different sizes side by side
+static void	print_table(const t_stats *s)
+{
+	int	i;
+
+	printf("stats: %-16s %12s %12s\n", "stage", "wall ms", "cpu ms");
+	i = -1;
+	while (++i < STAGES)
+		printf("stats: %-16s %12.2f %12.2f\n", g_stage_names[i],
+			s->wall_ms[i], s->cpu_ms[i]);
+	if (!STATS_COUNTERS)
+	{
+		printf("stats: counters not built in, use make STATS=1\n");
+		return ;
+	}
+	printf("stats: %-16s %12s %12s\n", "counter", "total", "per primary");
+	i = -1;
+	while (++i < COUNTERS)
+		printf("stats: %-16s %12ld %12.3f\n", g_counter_names[i],
+			s->count[i], (double)s->count[i]
+			/ (s->count[STAT_PRIMARY] + !s->count[STAT_PRIMARY]));
+}
+
+// {"primary_rays": .., ..}, or null when the counters aren't built in
+static void	json_counters(int fd, const t_stats *s)
+{
+	int	i;
+
+	if (!STATS_COUNTERS)
+	{
+		dprintf(fd, "null");
+		return ;
+	}
+	dprintf(fd, "{");
+	i = -1;
+	while (++i < COUNTERS)
+	{
+		if (i)
+			dprintf(fd, ", ");
+		dprintf(fd, "\"%s\": %ld", g_counter_names[i], s->count[i]);
+	}
+	dprintf(fd, "}");
+}
+
+// {"stages": {"load": {"wall_ms": .., "cpu_ms": ..}, ..}, "counters": ..}
+static int	write_json(const t_stats *s, const char *path)
+{
+	int	fd;
+	int	i;
+
+	fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+	if (fd < 0)
+		return (printf("Output error: cannot write %s\n", path), 1);
+	dprintf(fd, "{\"stages\": {");
+	i = -1;
+	while (++i < STAGES)
+	{
+		if (i)
+			dprintf(fd, ", ");
+		dprintf(fd, "\"%s\": {\"wall_ms\": %.3f, \"cpu_ms\": %.3f}",
+			g_stage_names[i], s->wall_ms[i], s->cpu_ms[i]);
+	}
+	dprintf(fd, "}, \"counters\": ");
+	json_counters(fd, s);
+	dprintf(fd, "}\n");
+	if (close(fd) < 0)
+		return (printf("Output error: cannot write %s\n", path), 1);
+	return (0);
+}
+
+// --stats prints the table, --stats-json writes the same as json
+int	stats_report(const t_stats *s, const t_options *opts)
+{
+	if (opts->stats)
+		print_table(s);
+	if (opts->stats_json)
+		return (write_json(s, opts->stats_json));
+	return (0);
+}
@@ -0,0 +1,41 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   stats_stages.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: sabruma <sabruma@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:59:32 by sabruma           #+#    #+#             */
+/*   Updated: 2026/10/17 23:59:32 by sabruma          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minirt_stats.h"
+#include "minirt_output.h"
+#include <time.h>
+
+static double	cpu_ms(void)
+{
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts);
+	return (ts.tv_sec * 1000.0 + ts.tv_nsec / 1e6);
+}
+
+// stages can run many times (strips, bench frames), the times add up.
+// s may be NULL for work that shouldn't be reported
+void	stage_begin(t_stats *s, t_stage stage)
+{
+	if (!s)
+		return ;
+	s->since_wall[stage] = now_ms();
+	s->since_cpu[stage] = cpu_ms();
+}
+
+void	stage_end(t_stats *s, t_stage stage)
+{
+	if (!s)
+		return ;
+	s->wall_ms[stage] += now_ms() - s->since_wall[stage];
+	s->cpu_ms[stage] += cpu_ms() - s->since_cpu[stage];
+}
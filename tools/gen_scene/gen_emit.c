@@ -0,0 +1,68 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gen_emit.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: sabruma <sabruma@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:41:40 by sabruma           #+#    #+#             */
+/*   Updated: 2026/10/18 01:22:33 by sabruma          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "gen_scene.h"
+
+// camera in front of the box, light above it to the left
+void	emit_header(void)
+{
+	printf("A 0.2 255,255,255\n");
+	printf("C 0,0,-20 0,0,1 70\n");
+	printf("L -40,50,-20 0.7 255,255,255\n");
+}
+
+// colors come after the geometry so they never shift the shapes
+static void	emit_color(t_gen *g)
+{
+	uint64_t	rgb;
+
+	rgb = rng_next(g);
+	printf(" %d,%d,%d\n", (int)(rgb & 255), (int)(rgb >> 8 & 255),
+		(int)(rgb >> 16 & 255));
+}
+
+// sizes as %.6g: the thin ones of a 10M scene are about 0.001, which %.3f
+// rounds to nothing. every size is >= 1e-4, so %g never goes to exponents
+// the scene parser doesn't read
+void	emit_sphere(t_gen *g, t_gvec c, double diameter)
+{
+	printf("sp %.3f,%.3f,%.3f %.6g", c.x, c.y, c.z, diameter);
+	emit_color(g);
+}
+
+// size is diameter, height
+void	emit_cylinder(t_gen *g, t_gvec c, t_gvec axis, double size[2])
+{
+	printf("cy %.3f,%.3f,%.3f %.4f,%.4f,%.4f %.6g %.6g", c.x, c.y, c.z,
+		axis.x, axis.y, axis.z, size[0], size[1]);
+	emit_color(g);
+}
+
+// the floor, then planes in random directions well outside the box:
+// every ray tests all of them, so they cost whatever the layout is
+void	emit_planes(t_gen *g)
+{
+	t_gvec	n;
+	double	d;
+	int		i;
+
+	printf("pl 0,-12,0 0,1,0 120,120,120\n");
+	i = 1;
+	while (i++ < g->planes)
+	{
+		n = rng_dir(g);
+		d = rng_range(g, 80.0, 160.0);
+		printf("pl %.3f,%.3f,%.3f %.4f,%.4f,%.4f", -n.x * d, -n.y * d,
+			30.0 - n.z * d, n.x, n.y, n.z);
+		emit_color(g);
+	}
+}
@@ -0,0 +1,115 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gen_layouts.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: sabruma <sabruma@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:41:40 by sabruma           #+#    #+#             */
+/*   Updated: 2026/10/17 23:41:40 by sabruma          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "gen_scene.h"
+
+// one object in four is a short cylinder, the rest spheres,
+// both about half the spacing across
+static void	emit_object(t_gen *g, long i, t_gvec c, double scale)
+{
+	double	size[2];
+
+	if (i % 4 == 3)
+	{
+		size[0] = rng_range(g, 0.2, 0.5) * scale;
+		size[1] = rng_range(g, 0.5, 1.5) * scale;
+		emit_cylinder(g, c, rng_dir(g), size);
+	}
+	else
+		emit_sphere(g, c, rng_range(g, 0.3, 0.7) * scale);
+}
+
+void	gen_uniform(t_gen *g)
+{
+	long	i;
+
+	i = 0;
+	while (i < g->count)
+	{
+		emit_object(g, i, rng_in_box(g), g->spacing);
+		i++;
+	}
+}
+
+// tight blobs of GEN_CLUSTER_SIZE objects with empty space between them,
+// the case where a binned SAH build pays off most
+void	gen_clustered(t_gen *g)
+{
+	t_gvec	center;
+	t_gvec	d;
+	double	radius;
+	long	i;
+
+	center = (t_gvec){0};
+	radius = 0.0;
+	i = 0;
+	while (i < g->count)
+	{
+		if (i % GEN_CLUSTER_SIZE == 0)
+		{
+			center = rng_in_box(g);
+			radius = rng_range(g, 1.0, 4.0);
+		}
+		d = rng_dir(g);
+		d.x = center.x + d.x * radius * rng_range(g, 0.0, 1.0);
+		d.y = center.y + d.y * radius * rng_range(g, 0.0, 1.0);
+		d.z = center.z + d.z * radius * rng_range(g, 0.0, 1.0);
+		emit_object(g, i, d, g->spacing * 0.25);
+		i++;
+	}
+}
+
+// concentric spheres around a cylinder: every box of a group contains
+// the next one, so traversal can't cull anything inside the group
+void	gen_nested(t_gen *g)
+{
+	t_gvec	center;
+	double	size[2];
+	long	i;
+
+	center = (t_gvec){0};
+	i = 0;
+	while (i < g->count)
+	{
+		if (i % GEN_NEST_DEPTH == 0)
+			center = rng_in_box(g);
+		if (i % GEN_NEST_DEPTH == GEN_NEST_DEPTH - 1)
+		{
+			size[0] = g->spacing * 0.1;
+			size[1] = g->spacing * 2.0;
+			emit_cylinder(g, center, rng_dir(g), size);
+		}
+		else
+			emit_sphere(g, center, g->spacing * 1.5
+				* (GEN_NEST_DEPTH - i % GEN_NEST_DEPTH) / GEN_NEST_DEPTH);
+		i++;
+	}
+}
+
+// long thin cylinders in random directions, a hundred times longer than
+// wide: huge boxes around almost no surface, the worst case for AABBs
+void	gen_thin(t_gen *g)
+{
+	t_gvec	center;
+	double	size[2];
+	long	i;
+
+	i = 0;
+	while (i < g->count)
+	{
+		center = rng_in_box(g);
+		size[0] = rng_range(g, 0.01, 0.04) * g->spacing;
+		size[1] = rng_range(g, 2.0, 6.0) * g->spacing;
+		emit_cylinder(g, center, rng_dir(g), size);
+		i++;
+	}
+}
@@ -0,0 +1,60 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gen_random.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: sabruma <sabruma@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:41:40 by sabruma           #+#    #+#             */
+/*   Updated: 2026/10/17 23:41:40 by sabruma          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "gen_scene.h"
+#include <math.h>
+
+// splitmix64: one add and a few mixes per number, no hidden state
+uint64_t	rng_next(t_gen *g)
+{
+	uint64_t	z;
+
+	g->state += 0x9E3779B97F4A7C15ull;
+	z = g->state;
+	z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+	z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+	return (z ^ (z >> 31));
+}
+
+// top 53 bits as a double in [lo, hi)
+double	rng_range(t_gen *g, double lo, double hi)
+{
+	return (lo + (hi - lo) * ((rng_next(g) >> 11) * 0x1.0p-53));
+}
+
+// uniform on the unit sphere, by rejection from the cube
+t_gvec	rng_dir(t_gen *g)
+{
+	t_gvec	d;
+	double	len;
+
+	len = 0.0;
+	while (len < 1e-4 || len > 1.0)
+	{
+		d.x = rng_range(g, -1.0, 1.0);
+		d.y = rng_range(g, -1.0, 1.0);
+		d.z = rng_range(g, -1.0, 1.0);
+		len = d.x * d.x + d.y * d.y + d.z * d.z;
+	}
+	len = sqrt(len);
+	return ((t_gvec){d.x / len, d.y / len, d.z / len});
+}
+
+t_gvec	rng_in_box(t_gen *g)
+{
+	t_gvec	p;
+
+	p.x = rng_range(g, -GEN_BOX_X, GEN_BOX_X);
+	p.y = rng_range(g, -GEN_BOX_Y, GEN_BOX_Y);
+	p.z = rng_range(g, GEN_BOX_Z0, GEN_BOX_Z1);
+	return (p);
+}
@@ -0,0 +1,66 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gen_scene.h                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: sabruma <sabruma@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:41:40 by sabruma           #+#    #+#             */
+/*   Updated: 2026/10/17 23:41:40 by sabruma          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef GEN_SCENE_H
+# define GEN_SCENE_H 1
+
+# include <stdint.h>
+# include <stdio.h>
+
+# define GEN_MAX_OBJECTS 10000000
+# define GEN_DEFAULT_SEED 42
+
+// objects fill [-20,20] x [-10,10] x [10,50] in front of the camera
+# define GEN_BOX_X 20.0
+# define GEN_BOX_Y 10.0
+# define GEN_BOX_Z0 10.0
+# define GEN_BOX_Z1 50.0
+
+// shells per nested group, spheres in each cluster of the clustered layout
+# define GEN_NEST_DEPTH 6
+# define GEN_CLUSTER_SIZE 4096
+
+typedef struct s_gvec
+{
+	double	x;
+	double	y;
+	double	z;
+}	t_gvec;
+
+// the whole output depends only on the seed and the arguments:
+// the generator is splitmix64, the same on every machine
+typedef struct s_gen
+{
+	uint64_t	state;
+	long		count;
+	int			planes;
+	double		spacing;	// mean distance between objects for count
+}	t_gen;
+
+typedef void	(*t_layout)(t_gen *g);
+
+uint64_t	rng_next(t_gen *g);
+double		rng_range(t_gen *g, double lo, double hi);
+t_gvec		rng_dir(t_gen *g);
+t_gvec		rng_in_box(t_gen *g);
+
+void		emit_header(void);
+void		emit_sphere(t_gen *g, t_gvec c, double diameter);
+void		emit_cylinder(t_gen *g, t_gvec c, t_gvec axis, double size[2]);
+void		emit_planes(t_gen *g);
+
+void		gen_uniform(t_gen *g);
+void		gen_clustered(t_gen *g);
+void		gen_nested(t_gen *g);
+void		gen_thin(t_gen *g);
+
+#endif
@@ -0,0 +1,85 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   main.c                                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: sabruma <sabruma@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:41:51 by sabruma           #+#    #+#             */
+/*   Updated: 2026/10/17 23:41:51 by sabruma          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "gen_scene.h"
+#include <limits.h>
+#include <math.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define USAGE "Usage: %s <uniform|clustered|nested|thin> <count> \
+[seed [planes]]\n"
+
+typedef struct s_layout_name
+{
+	const char	*name;
+	t_layout	run;
+}	t_layout_name;
+
+static const t_layout_name	g_layouts[] = {
+{"uniform", gen_uniform},
+{"clustered", gen_clustered},
+{"nested", gen_nested},
+{"thin", gen_thin},
+{NULL, NULL}
+};
+
+static t_layout	find_layout(const char *name)
+{
+	int	i;
+
+	i = 0;
+	while (g_layouts[i].name && strcmp(g_layouts[i].name, name) != 0)
+		i++;
+	return (g_layouts[i].run);
+}
+
+// strtol that refuses garbage, negatives and anything past max
+static bool	read_long(const char *s, long max, long *out)
+{
+	char	*end;
+
+	*out = strtol(s, &end, 10);
+	return (end != s && !*end && *out >= 0 && *out <= max);
+}
+
+// same arguments, same seed: byte for byte the same scene, so benchmarks
+// of different versions can be compared on identical input
+int	main(int argc, char **argv)
+{
+	static char	buf[1 << 20];
+	t_layout	layout;
+	t_gen		g;
+	long		seed;
+	long		planes;
+
+	g = (t_gen){0};
+	seed = GEN_DEFAULT_SEED;
+	planes = 1;
+	layout = NULL;
+	if (argc >= 3 && argc <= 5)
+		layout = find_layout(argv[1]);
+	if (!layout || !read_long(argv[2], GEN_MAX_OBJECTS, &g.count)
+		|| (argc > 3 && !read_long(argv[3], LONG_MAX, &seed))
+		|| (argc > 4 && (!read_long(argv[4], 100000, &planes) || !planes)))
+		return (fprintf(stderr, USAGE, argv[0]), 1);
+	g.state = seed;
+	g.planes = planes;
+	g.spacing = cbrt(4.0 * GEN_BOX_X * GEN_BOX_Y * (GEN_BOX_Z1 - GEN_BOX_Z0)
+			/ (g.count + 1));
+	setvbuf(stdout, buf, _IOFBF, sizeof(buf));
+	emit_header();
+	emit_planes(&g);
+	layout(&g);
+	return (fflush(stdout) != 0);
+}